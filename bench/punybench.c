@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * punybench: per-phase encoder profile of corpora of labels.
+ *
+ * Usage: punybench [-b | -k] [-n iterations] [corpus ...]
+ *
+ * Every corpus is a file with one label per line. Without arguments, the
+ * built-in corpora are used. Needs a library built with -Dprofile=true.
+ *
+ * With -b, times punyenc_batch() against punyenc_batch_lanes() on a column
+ * made of the labels of every corpus instead.
+ *
+ * With -k, times the cache key of punycoded(8), punyhash_ace() of the label,
+ * against punyhash() and punyenc_host() of it instead.
+ */
+
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <punycode.h>
+
+struct corpus {
+	const char *name;
+	char **labels;
+	size_t n;
+};
+
+static void bench(const struct corpus *, long);
+static void batchbench(const struct corpus *, long);
+static double batchtime(size_t (*)(const char *, const uint32_t *, size_t,
+    char *, size_t, uint32_t *, unsigned char *), const char *,
+    const uint32_t *, size_t, char *, size_t, uint32_t *, long);
+static void keybench(const struct corpus *, long);
+static double keytime(const struct corpus *, long, int);
+static void load(struct corpus *, const char *);
+static void pct(uint_least64_t, uint_least64_t);
+
+static const char *const phasenames[PUNYPROF_PHASES] = {
+	[PUNYPROF_DECODE] = "decode",
+	[PUNYPROF_MINSCAN] = "minscan",
+	[PUNYPROF_DELTA] = "delta",
+	[PUNYPROF_ADAPT] = "adapt",
+};
+
+static const char *ascii[] = {
+	"example", "wikipedia", "localhost", "mail", "www", "openbsd",
+	"a-very-long-label-that-is-still-valid-in-the-domain-name-system",
+};
+static const char *latin[] = {
+	"bücher", "ñandú", "leoš janáček", "straße", "żółć", "müller",
+	"crème-brûlée", "ångström", "façade", "piñata",
+};
+static const char *cjk[] = {
+	"中文", "日本語", "한국어", "他们为什么不说中文", "なぜみんな日本語を話してくれないのか",
+	"세계의모든사람들이한국어를이해한다면얼마나좋을까",
+};
+static const char *mixed[] = {
+	"3年b組金八先生", "安室奈美恵-with-super-monkeys", "hello-another-way-それぞれの場所",
+	"ひとつ屋根の下2", "pročprostěnemluvíčesky", "почемужеонинеговорятпорусски",
+	"ليهمابتكلموشعربي؟", "májkäcselý",
+};
+
+int
+main(int argc, char *argv[])
+{
+	static struct corpus builtin[] = {
+		{"ascii", (char **)ascii, sizeof(ascii) / sizeof(*ascii)},
+		{"latin", (char **)latin, sizeof(latin) / sizeof(*latin)},
+		{"cjk", (char **)cjk, sizeof(cjk) / sizeof(*cjk)},
+		{"mixed", (char **)mixed, sizeof(mixed) / sizeof(*mixed)},
+	};
+	struct punyprof p[PUNYPROF_PHASES];
+	struct corpus c;
+	void (*fn)(const struct corpus *, long) = bench;
+	long iterations = 100000;
+	char *end;
+	int ch;
+	size_t i;
+
+	while ((ch = getopt(argc, argv, "bkn:")) != -1) {
+		switch (ch) {
+		case 'b':
+			fn = batchbench;
+			break;
+		case 'k':
+			fn = keybench;
+			break;
+		case 'n':
+			iterations = strtol(optarg, &end, 10);
+			if (*optarg == '\0' || *end != '\0' || iterations <= 0)
+				errx(1, "invalid iteration count: %s", optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-b | -k] [-n iterations]"
+			    " [corpus ...]\n", getprogname());
+			exit(1);
+		}
+	}
+	argv += optind;
+
+	if (fn != bench)
+		;
+	else if (punyprof_get(p) == -1)
+		errx(1, "libpunycode was built without -Dprofile=true");
+	else if (punyprof_get(p) == PUNYPROF_CLOCK) {
+		warnx("no hardware counters, the cycles column holds"
+		    " nanoseconds");
+	}
+
+	if (*argv == NULL) {
+		for (i = 0; i < sizeof(builtin) / sizeof(*builtin); i++)
+			fn(&builtin[i], iterations);
+	}
+	for (; *argv != NULL; argv++) {
+		load(&c, *argv);
+		fn(&c, iterations);
+		for (i = 0; i < c.n; i++)
+			free(c.labels[i]);
+		free(c.labels);
+	}
+	return 0;
+}
+
+/* bench: encode corpus c iterations times and print its profile */
+static void
+bench(const struct corpus *c, long iterations)
+{
+	struct punyprof p[PUNYPROF_PHASES];
+	uint_least64_t total;
+	char buf[1024];
+	long it;
+	size_t i;
+	int ph;
+
+	punyprof_reset();
+	for (it = 0; it < iterations; it++) {
+		for (i = 0; i < c->n; i++)
+			(void)punyenc(buf, c->labels[i], sizeof(buf));
+	}
+	punyprof_get(p);
+
+	for (total = 0, ph = 0; ph < PUNYPROF_PHASES; ph++)
+		total += p[ph].cycles;
+	printf("%s: %zu labels, %ld iterations\n", c->name, c->n, iterations);
+	printf("%-8s %12s %14s %6s %14s %6s %12s %12s\n", "phase", "calls",
+	    "cycles", "%", "instructions", "ipc", "br-misses", "l1d-misses");
+	for (ph = 0; ph < PUNYPROF_PHASES; ph++) {
+		printf("%-8s %12llu %14llu ", phasenames[ph],
+		    (unsigned long long)p[ph].calls,
+		    (unsigned long long)p[ph].cycles);
+		pct(p[ph].cycles, total);
+		printf(" %14llu %6.2f %12llu %12llu\n",
+		    (unsigned long long)p[ph].instructions,
+		    p[ph].cycles ? (double)p[ph].instructions / p[ph].cycles
+		    : 0.0,
+		    (unsigned long long)p[ph].branchmisses,
+		    (unsigned long long)p[ph].l1dmisses);
+	}
+	putchar('\n');
+}
+
+/* batchbench: time the batch encoders on a column of the labels of c
+ * The labels are repeated until the column has at least 8192 rows, and the
+ * column is encoded iterations / 100 times.
+ */
+static void
+batchbench(const struct corpus *c, long iterations)
+{
+	char *data, *dst, *dst2;
+	uint32_t *offsets, *dstoffsets;
+	size_t n, i;
+	size_t len, size, dstsize;
+	double scalar, lanes;
+
+	n = (8192 + c->n - 1) / c->n * c->n;
+	if ((offsets = calloc(n + 1, sizeof(*offsets))) == NULL ||
+	    (dstoffsets = calloc(n + 1, sizeof(*dstoffsets))) == NULL)
+		err(1, "calloc");
+	for (size = i = 0; i < n; i++)
+		size += strlen(c->labels[i % c->n]);
+	if ((data = malloc(size)) == NULL)
+		err(1, "malloc");
+	for (i = 0; i < n; i++) {
+		len = strlen(c->labels[i % c->n]);
+		memcpy(data + offsets[i], c->labels[i % c->n], len);
+		offsets[i+1] = offsets[i] + len;
+	}
+	dstsize = punyenc_batch(data, offsets, n, NULL, 0, dstoffsets, NULL);
+	if ((dst = malloc(dstsize)) == NULL || (dst2 = malloc(dstsize)) == NULL)
+		err(1, "malloc");
+
+	iterations = iterations / 100 > 0 ? iterations / 100 : 1;
+	scalar = batchtime(punyenc_batch, data, offsets, n, dst, dstsize,
+	    dstoffsets, iterations);
+	lanes = batchtime(punyenc_batch_lanes, data, offsets, n, dst2, dstsize,
+	    dstoffsets, iterations);
+	if (memcmp(dst, dst2, dstsize) != 0)
+		errx(1, "%s: the batch encoders disagree", c->name);
+
+	printf("%-8s %8zu rows %10.1f ns/row scalar %10.1f ns/row lanes"
+	    " %6.2fx\n", c->name, n, scalar / n, lanes / n,
+	    lanes > 0 ? scalar / lanes : 0.0);
+	free(dst2);
+	free(dst);
+	free(data);
+	free(dstoffsets);
+	free(offsets);
+}
+
+/* batchtime: returns the nanoseconds per call of a batch encoder
+ * Takes the fastest call, the others were slowed down by something else.
+ */
+static double
+batchtime(size_t (*fn)(const char *, const uint32_t *, size_t, char *,
+    size_t, uint32_t *, unsigned char *), const char *data,
+    const uint32_t *offsets, size_t n, char *dst, size_t dstsize,
+    uint32_t *dstoffsets, long iterations)
+{
+	struct timespec t0, t1;
+	double ns, min;
+	long it;
+
+	for (min = -1, it = 0; it < iterations; it++) {
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		(void)fn(data, offsets, n, dst, dstsize, dstoffsets, NULL);
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+		if (min < 0 || ns < min)
+			min = ns;
+	}
+	return min;
+}
+
+/* keybench: time the ways to key a cache of the labels of c */
+static void
+keybench(const struct corpus *c, long iterations)
+{
+	double key, hash, enc;
+
+	key = keytime(c, iterations, 'k');
+	hash = keytime(c, iterations, 'h');
+	enc = keytime(c, iterations, 'e');
+	printf("%-8s %8.1f ns/label key %8.1f ns/label punyhash %8.1f ns/label"
+	    " punyenc_host %6.2fx\n", c->name, key, hash, enc,
+	    key > 0 ? enc / key : 0.0);
+}
+
+/* keytime: returns the nanoseconds per label of a way to key c
+ * way is 'k' for punyhash_ace(), 'h' for punyhash() and 'e' for
+ * punyenc_host(). Takes the fastest of 10 runs of iterations passes.
+ */
+static double
+keytime(const struct corpus *c, long iterations, int way)
+{
+	static volatile uint_least64_t sink;
+	struct timespec t0, t1;
+	char buf[1024];
+	double ns, min;
+	long it;
+	size_t i;
+	int run;
+
+	for (min = -1, run = 0; run < 10; run++) {
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		for (it = 0; it < iterations; it++) {
+			for (i = 0; i < c->n; i++) {
+				if (way == 'k')
+					sink = punyhash_ace(c->labels[i], 'e');
+				else if (way == 'h')
+					sink = punyhash(c->labels[i], 'e');
+				else
+					sink = punyenc_host(buf, c->labels[i],
+					    sizeof(buf));
+			}
+		}
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+		if (min < 0 || ns < min)
+			min = ns;
+	}
+	return min / ((double)iterations * c->n);
+}
+
+/* load: read the corpus at path into c */
+static void
+load(struct corpus *c, const char *path)
+{
+	FILE *fp;
+	char *line = NULL;
+	size_t linesz = 0;
+	ssize_t len;
+	size_t cap = 0;
+	void *tmp;
+
+	if ((fp = fopen(path, "r")) == NULL)
+		err(1, "%s", path);
+	c->name = path;
+	c->labels = NULL;
+	c->n = 0;
+	while ((len = getline(&line, &linesz, fp)) != -1) {
+		if (len > 0 && line[len-1] == '\n')
+			line[--len] = '\0';
+		if (c->n == cap) {
+			cap = cap ? cap * 2 : 64;
+			tmp = reallocarray(c->labels, cap, sizeof(*c->labels));
+			if (tmp == NULL)
+				err(1, "reallocarray");
+			c->labels = tmp;
+		}
+		if ((c->labels[c->n++] = strdup(line)) == NULL)
+			err(1, "strdup");
+	}
+	if (ferror(fp))
+		err(1, "%s", path);
+	free(line);
+	fclose(fp);
+}
+
+/* pct: print part as a percentage of total */
+static void
+pct(uint_least64_t part, uint_least64_t total)
+{
+	printf("%5.1f%%", total ? 100.0 * part / total : 0.0);
+}
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * punyfuzz: differential fuzzer and worst case benchmark.
+ *
+ * Every input is run through the library and through the RFC 3492 sample
+ * implementation in spec/punycode-sample.c, and the results must agree. If the
+ * first byte is even, the rest of the input is a label for the encoder: bytes
+ * below 0x80 are ASCII code points, any other byte takes the next 2 with it to
+ * form a non-ASCII code point. If it's odd, the rest is punycode for the
+ * decoder.
+ *
+ * Built with -DPUNYFUZZ_LIBFUZZER, this is a libFuzzer target. The
+ * PUNYFUZZ_MAXNS environment variable then makes it abort on inputs of 64
+ * bytes or more that take longer than that many nanoseconds per byte, so that
+ * libFuzzer keeps them.
+ *
+ * Otherwise, it's a benchmark, which also works as an AFL target:
+ *
+ *	punyfuzz [-b maxns] [-n iterations] file ...
+ *
+ * It checks every file, and every file in the directories it's given, times
+ * it, and prints its nanoseconds per byte and the maximum and mean over all
+ * files. With -b, it fails if the maximum is above maxns.
+ */
+
+#include <sys/stat.h>
+
+#include <dirent.h>
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <punycode.h>
+
+/*
+ * The sample has its own main(), for its command line tool, which passes
+ * unsigned int * for size_t *. It's never called.
+ */
+#define main sample_main
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wincompatible-pointer-types"
+#endif
+#include "punycode-sample.c"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+#undef main
+
+enum {
+	/* Longest input, in bytes, and longest output, in code points. */
+	maxinput = 1 << 16,
+};
+
+static size_t tolabel(char *, punycode_uint *, const uint8_t *, size_t);
+static size_t toace(char *, const uint8_t *, size_t);
+static double check(const uint8_t *, size_t, long);
+static double elapsed(const struct timespec *);
+static void mismatch(const char *, const uint8_t *, size_t);
+#if !defined(PUNYFUZZ_LIBFUZZER)
+static void bench(const char *, long);
+#endif
+
+static char label[maxinput * 4 + 1];
+static char ace[maxinput * 8 + 1];
+static char ace2[maxinput * 8 + 1];
+static punycode_uint cps[maxinput + 1];
+static punycode_uint cps2[maxinput + 1];
+static uint_least32_t dec[maxinput + 1];
+
+#if defined(PUNYFUZZ_LIBFUZZER)
+int LLVMFuzzerTestOneInput(const uint8_t *, size_t);
+
+int
+LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	static double maxns = -1;
+	const char *s;
+	double ns;
+
+	if (maxns == -1)
+		maxns = (s = getenv("PUNYFUZZ_MAXNS")) != NULL ? atof(s) : 0;
+	ns = check(data, size, 1);
+	if (maxns > 0 && size >= 64 && ns / size > maxns) {
+		fprintf(stderr, "punyfuzz: %.1f ns/byte on %zu bytes\n",
+		    ns / size, size);
+		abort();
+	}
+	return 0;
+}
+#else
+static double max, sum;
+static const char *maxfile;
+static int nfiles;
+
+int
+main(int argc, char *argv[])
+{
+	struct stat st;
+	double maxns = 0;
+	long iterations = 10;
+	char path[4096];
+	struct dirent *de;
+	DIR *dir;
+	char *end;
+	int ch;
+
+	while ((ch = getopt(argc, argv, "b:n:")) != -1) {
+		switch (ch) {
+		case 'b':
+			maxns = strtod(optarg, &end);
+			if (*optarg == '\0' || *end != '\0' || maxns <= 0)
+				errx(1, "invalid bound: %s", optarg);
+			break;
+		case 'n':
+			iterations = strtol(optarg, &end, 10);
+			if (*optarg == '\0' || *end != '\0' || iterations <= 0)
+				errx(1, "invalid iteration count: %s", optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-b maxns] [-n iterations]"
+			    " file ...\n", getprogname());
+			exit(1);
+		}
+	}
+	argv += optind;
+
+	for (; *argv != NULL; argv++) {
+		if (stat(*argv, &st) == -1)
+			err(1, "%s", *argv);
+		if (!S_ISDIR(st.st_mode)) {
+			bench(*argv, iterations);
+			continue;
+		}
+		if ((dir = opendir(*argv)) == NULL)
+			err(1, "%s", *argv);
+		while ((de = readdir(dir)) != NULL) {
+			if (de->d_name[0] == '.')
+				continue;
+			if ((size_t)snprintf(path, sizeof(path), "%s/%s", *argv,
+			    de->d_name) >= sizeof(path))
+				errx(1, "%s/%s: path too long", *argv,
+				    de->d_name);
+			bench(path, iterations);
+		}
+		closedir(dir);
+	}
+	if (nfiles == 0)
+		return 0;
+	printf("max %.1f ns/byte (%s), mean %.1f ns/byte\n", max, maxfile,
+	    sum / nfiles);
+	if (maxns > 0 && max > maxns)
+		errx(1, "%s is above the bound of %.1f ns/byte", maxfile,
+		    maxns);
+	return 0;
+}
+
+/* bench: check and time the file at path */
+static void
+bench(const char *path, long iterations)
+{
+	static uint8_t buf[maxinput + 1];
+	double nspb;
+	FILE *fp;
+	size_t len;
+
+	if ((fp = fopen(path, "rb")) == NULL)
+		err(1, "%s", path);
+	len = fread(buf, 1, sizeof(buf), fp);
+	if (ferror(fp))
+		err(1, "%s", path);
+	if (len == sizeof(buf))
+		errx(1, "%s: longer than %d bytes", path, maxinput);
+	fclose(fp);
+
+	nspb = len > 0 ? check(buf, len, iterations) / len : 0;
+	printf("%-40s %8zu bytes %10.1f ns/byte\n", path, len, nspb);
+	if (nspb > max) {
+		max = nspb;
+		free((void *)maxfile);
+		if ((maxfile = strdup(path)) == NULL)
+			err(1, "strdup");
+	}
+	sum += nspb;
+	nfiles++;
+}
+#endif
+
+/* check: run the input through both implementations and compare the results
+ * Returns the fastest of iterations runs of the library, at least 1, in
+ * nanoseconds.
+ */
+static double
+check(const uint8_t *data, size_t size, long iterations)
+{
+	struct timespec t0;
+	enum punycode_status st;
+	size_t len, len2;
+	size_t ncps;
+	double ns, min;
+	long it;
+	size_t i;
+
+	if (size == 0 || size > maxinput)
+		return 0;
+
+	min = -1;
+	if (data[0] % 2 == 0) {
+		ncps = tolabel(label, cps, data + 1, size - 1);
+		it = 0;
+		do {
+			clock_gettime(CLOCK_MONOTONIC, &t0);
+			len = punyenc(ace, label, sizeof(ace));
+			if ((ns = elapsed(&t0)) < min || min < 0)
+				min = ns;
+		} while (++it < iterations);
+		len2 = sizeof(ace2);
+		st = punycode_encode(ncps, cps, NULL, &len2, ace2);
+		if (st == punycode_overflow && len == (size_t)-1)
+			return min;
+		if (st != punycode_success || len != len2
+		    || memcmp(ace, ace2, len))
+			mismatch("punyenc", data, size);
+
+		/* And back. */
+		if (punydec_u32(dec, ace, sizeof(dec) / sizeof(*dec)) != ncps)
+			mismatch("punydec_u32 round trip", data, size);
+		for (i = 0; i < ncps; i++) {
+			if (dec[i] != cps[i])
+				mismatch("punydec_u32 round trip", data, size);
+		}
+		return min;
+	}
+
+	len2 = toace(ace2, data + 1, size - 1);
+	it = 0;
+	do {
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		len = punydec_u32(dec, ace2, sizeof(dec) / sizeof(*dec));
+		if ((ns = elapsed(&t0)) < min || min < 0)
+			min = ns;
+	} while (++it < iterations);
+	ncps = sizeof(cps2) / sizeof(*cps2);
+	st = punycode_decode(len2, ace2, &ncps, cps2, NULL);
+
+	/* The library also rejects code points that Unicode doesn't have. */
+	for (i = 0; st == punycode_success && i < ncps; i++) {
+		if (cps2[i] > 0x10FFFF
+		    || (cps2[i] >= 0xD800 && cps2[i] <= 0xDFFF))
+			st = punycode_bad_input;
+	}
+	if (st != punycode_success) {
+		if (len != (size_t)-1)
+			mismatch("punydec_u32 accepted", data, size);
+		return min;
+	}
+	if (len != ncps)
+		mismatch("punydec_u32", data, size);
+	for (i = 0; i < ncps; i++) {
+		if (dec[i] != cps2[i])
+			mismatch("punydec_u32", data, size);
+	}
+	return min;
+}
+
+/* tolabel: turn fuzzer data into a UTF-8 label and its code points
+ * NULs are dropped and surrogates become U+FFFD. Returns the amount of code
+ * points.
+ */
+static size_t
+tolabel(char *dst, punycode_uint *cp, const uint8_t *p, size_t size)
+{
+	const uint8_t *end = p + size;
+	uint_least32_t c;
+	size_t n;
+
+	for (n = 0; p < end; n++) {
+		if (*p < 0x80)
+			c = *p++;
+		else if (end - p < 3)
+			break;
+		else {
+			c = ((uint_least32_t)(p[0] & 0x1F) << 16 | p[1] << 8
+			    | p[2]) % 0x110000;
+			p += 3;
+		}
+		if (c == 0) {
+			n--;
+			continue;
+		}
+		if (c >= 0xD800 && c <= 0xDFFF)
+			c = 0xFFFD;
+		cp[n] = c;
+		if (c < 0x80) {
+			*dst++ = c;
+		} else if (c < 0x800) {
+			*dst++ = 0xC0 | c >> 6;
+			*dst++ = 0x80 | (c & 0x3F);
+		} else if (c < 0x10000) {
+			*dst++ = 0xE0 | c >> 12;
+			*dst++ = 0x80 | (c >> 6 & 0x3F);
+			*dst++ = 0x80 | (c & 0x3F);
+		} else {
+			*dst++ = 0xF0 | c >> 18;
+			*dst++ = 0x80 | (c >> 12 & 0x3F);
+			*dst++ = 0x80 | (c >> 6 & 0x3F);
+			*dst++ = 0x80 | (c & 0x3F);
+		}
+	}
+	*dst = '\0';
+	return n;
+}
+
+/* toace: turn fuzzer data into a '\0' terminated ASCII string
+ * NULs are dropped. Returns its length.
+ */
+static size_t
+toace(char *dst, const uint8_t *p, size_t size)
+{
+	size_t n;
+	size_t i;
+
+	for (n = i = 0; i < size; i++) {
+		if ((p[i] & 0x7F) != 0)
+			dst[n++] = p[i] & 0x7F;
+	}
+	dst[n] = '\0';
+	return n;
+}
+
+/* elapsed: returns the nanoseconds since t0 */
+static double
+elapsed(const struct timespec *t0)
+{
+	struct timespec t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return (t1.tv_sec - t0->tv_sec) * 1e9 + (t1.tv_nsec - t0->tv_nsec);
+}
+
+/* mismatch: report an input the implementations disagree on and abort */
+static void
+mismatch(const char *what, const uint8_t *data, size_t size)
+{
+	size_t i;
+
+	fprintf(stderr, "punyfuzz: %s disagrees with the sample on:", what);
+	for (i = 0; i < size && i < 64; i++)
+		fprintf(stderr, " %02x", data[i]);
+	fprintf(stderr, "%s\n", size > 64 ? " ..." : "");
+	abort();
+}
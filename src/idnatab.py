@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+# Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+# Generate idnatab.h, the IDNA2008 property tables of libpunycode.c:
+#     python3 src/idnatab.py > src/idnatab.h
+#
+# The properties come from Python's unicodedata and from the RFC 5892 tables of
+# the idna package (pip install idna). Code points that Python's Unicode
+# version doesn't assign are UNASSIGNED, whatever version idna is for.
+
+import sys
+import unicodedata
+
+import idna.idnadata
+import idna.package_data
+
+# Must match the enums in libpunycode.c.
+CLASSES = ['DISALLOWED', 'PVALID', 'CONTEXTJ', 'CONTEXTO']
+BIDI = ['L', 'R', 'AL', 'AN', 'EN', 'ES', 'CS', 'ET', 'ON', 'BN', 'NSM']
+BIDI_OTHER = len(BIDI)
+JOINING = {'U': 0, 'L': 1, 'R': 2, 'D': 3, 'T': 4, 'C': 5}
+SCRIPTS = ['Greek', 'Hebrew', 'Hiragana', 'Katakana', 'Han']
+
+NCP = 0x110000
+
+
+def ranges(intranges):
+    for r in intranges:
+        yield range(r >> 32, r & 0xffffffff)
+
+
+def joining():
+    # Older idna versions map code points to the ord() of their joining type,
+    # newer ones map joining types to ranges of code points.
+    join = [JOINING['U']] * NCP
+    for key, value in idna.idnadata.joining_types.items():
+        if isinstance(key, str):
+            for r in ranges(value):
+                for cp in r:
+                    join[cp] = JOINING[key]
+        else:
+            join[key] = JOINING[chr(value)]
+    return join
+
+
+def props():
+    cls = [0] * NCP
+    for name in ('PVALID', 'CONTEXTJ', 'CONTEXTO'):
+        for r in ranges(idna.idnadata.codepoint_classes[name]):
+            for cp in r:
+                cls[cp] = CLASSES.index(name)
+    join = joining()
+    script = [0] * NCP
+    for i, name in enumerate(SCRIPTS):
+        for r in ranges(idna.idnadata.scripts[name]):
+            for cp in r:
+                script[cp] = i + 1
+
+    # A DISALLOWED or UNASSIGNED code point fails the label whatever its
+    # other properties are, so they're all 0.
+    p = [0] * NCP
+    for cp in range(NCP):
+        c = chr(cp)
+        if unicodedata.category(c) == 'Cn' or cls[cp] == 0:
+            continue
+        bidi = unicodedata.bidirectional(c)
+        b = BIDI.index(bidi) if bidi in BIDI else BIDI_OTHER
+        mark = unicodedata.category(c)[0] == 'M'
+        virama = unicodedata.combining(c) == 9
+        p[cp] = (cls[cp] | b << 2 | mark << 6 | virama << 7 | join[cp] << 8
+                 | script[cp] << 11)
+
+    # Don't emit a table that lost a property to a change in the data.
+    for cp, j in ((0x628, 'D'), (0x627, 'R'), (0x300, 'T'), (0x200d, 'C')):
+        assert p[cp] >> 8 & 7 == JOINING[j], 'U+%04X isn\'t %s' % (cp, j)
+    assert p[0x94d] & 0xc0 == 0xc0, 'U+094D isn\'t a virama'
+    assert p[0x3b1] >> 11 == SCRIPTS.index('Greek') + 1, 'U+03B1 isn\'t Greek'
+    assert p[0x5d0] >> 2 & 15 == BIDI.index('R'), 'U+05D0 isn\'t R'
+    return p
+
+
+def tables(p, shift):
+    size = 1 << shift
+    # Past the last block with a code point that isn't DISALLOWED, the
+    # validator doesn't look the code points up.
+    ncp = max(cp for cp in range(NCP) if p[cp] != 0) // size * size + size
+    p = p[:ncp]
+    values = sorted(set(p))
+    vindex = {v: i for i, v in enumerate(values)}
+    blocks = []
+    bindex = {}
+    stage1 = []
+    for start in range(0, ncp, size):
+        block = tuple(vindex[v] for v in p[start:start + size])
+        if block not in bindex:
+            bindex[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(bindex[block])
+    return values, stage1, blocks
+
+
+def cost(values, stage1, blocks):
+    return (len(values) * 2 + len(stage1) * (1 if len(blocks) <= 256 else 2)
+            + len(blocks) * len(blocks[0]))
+
+
+def array(out, ctype, name, data, perline):
+    out.write('static const %s %s[%d] = {\n' % (ctype, name, len(data)))
+    width = max(len(str(x)) for x in data)
+    for i in range(0, len(data), perline):
+        out.write('\t' + ' '.join('%*d,' % (width, x)
+                                  for x in data[i:i + perline]) + '\n')
+    out.write('};\n')
+
+
+def main():
+    p = props()
+    best = None
+    for shift in range(4, 11):
+        t = tables(p, shift)
+        if best is None or cost(*t) < cost(*best[1]):
+            best = (shift, t)
+    shift, (values, stage1, blocks) = best
+    assert len(values) <= 256
+
+    out = sys.stdout
+    out.write('/*\n'
+              ' * Generated by idnatab.py from Unicode %s and idna %s,'
+              ' do not edit.\n'
+              ' */\n'
+              % (unicodedata.unidata_version, idna.package_data.__version__))
+    out.write('\n')
+    out.write('/*\n'
+              ' * The properties of code point cp < IDNA_NCP are\n'
+              ' * idnaprop[idnablk[idnaidx[cp >> IDNA_SHIFT]][cp & IDNA_MASK]],\n'
+              ' * those of the others are 0.\n'
+              ' */\n')
+    out.write('#define IDNA_UNICODE "%s"\n' % unicodedata.unidata_version)
+    out.write('#define IDNA_SHIFT %d\n' % shift)
+    out.write('#define IDNA_MASK %d\n' % ((1 << shift) - 1))
+    out.write('#define IDNA_NCP %#x\n' % (len(stage1) << shift))
+    out.write('\n')
+    array(out, 'uint_least16_t', 'idnaprop', values, 8)
+    out.write('\n')
+    array(out, 'unsigned char' if len(blocks) <= 256 else 'uint_least16_t',
+          'idnaidx', stage1, 16)
+    out.write('\n')
+    out.write('static const unsigned char idnablk[%d][%d] = {\n'
+              % (len(blocks), 1 << shift))
+    for block in blocks:
+        out.write('\t{\n')
+        for i in range(0, len(block), 16):
+            out.write('\t\t' + ' '.join('%3d,' % x for x in block[i:i + 16])
+                      + '\n')
+        out.write('\t},\n')
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -27,9 +27,11 @@
 
 #include <limits.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "punycode.h"
+#include "idnatab.h"
 
 enum {
 	/* Punycode params. */
@@ -40,139 +42,2342 @@ enum {
 	damp		= 700,
 	initial_bias	= 72,
 	initial_n	= 128,
+
+	/* DNS limits. */
+	maxlabel	= 63,
+	maxname		= 255,
+
+	/* Inputs up to this many code units are decoded to UTF-32 first. */
+	fastlen		= 256,
+
+	/*
+	 * The decoder converts the digits to their values this many at a time,
+	 * so labels up to this long are validated before anything is decoded.
+	 */
+	digblock	= 256,
+
+	/*
+	 * punyenc_batch_lanes() encodes this many labels at once, if they have
+	 * at most lanecp code points. A code point takes at most 7 bytes of
+	 * punycode in such a label.
+	 */
+	lanes		= 8,
+	lanecp		= 64,
+	laneout		= lanecp * 8,
+
+	/*
+	 * Labels of up to this many code points get their deltas from
+	 * maskdeltas(), one bit per code point.
+	 */
+	maskcp		= 64,
+};
+
+/* Encodings of the encoder's input and the decoder's output. */
+enum {utf_8, utf_16, utf_32};
+
+/*
+ * IDNA2008 properties of a code point, from idnatab.h. The enums must match
+ * idnatab.py.
+ */
+#define PROP_CLASS(p)	((p) & 3)
+#define PROP_BIDI(p)	((p) >> 2 & 15)
+#define PROP_MARK(p)	((p) >> 6 & 1)
+#define PROP_VIRAMA(p)	((p) >> 7 & 1)
+#define PROP_JOIN(p)	((p) >> 8 & 7)
+#define PROP_SCRIPT(p)	((p) >> 11 & 7)
+enum {idna_disallowed, idna_pvalid, idna_contextj, idna_contexto};
+enum {
+	bidi_l, bidi_r, bidi_al, bidi_an, bidi_en, bidi_es, bidi_cs, bidi_et,
+	bidi_on, bidi_bn, bidi_nsm, bidi_other
+};
+enum {join_u, join_l, join_r, join_d, join_t, join_c};
+enum {
+	script_other, script_greek, script_hebrew, script_hiragana,
+	script_katakana, script_han
+};
+
+/* What the validator wants from the next code point, and what it saw. */
+enum {
+	WANT_L		= 1 << 0,	/* After U+00B7 MIDDLE DOT. */
+	WANT_GREEK	= 1 << 1,	/* After U+0375 GREEK KERAIA. */
+	WANT_JOIN	= 1 << 2,	/* A joining ZWNJ needs R or D after Ts. */
+};
+enum {
+	HAS_HYPHEN3	= 1 << 0,	/* The 3rd code point is '-'. */
+	HAS_KATADOT	= 1 << 1,	/* U+30FB KATAKANA MIDDLE DOT. */
+	HAS_KANA	= 1 << 2,	/* Hiragana, Katakana or Han. */
+	HAS_ARABDIG	= 1 << 3,	/* ARABIC-INDIC DIGITs. */
+	HAS_EXTDIG	= 1 << 4,	/* EXTENDED ARABIC-INDIC DIGITs. */
+};
+
+/* Bidi classes allowed in right-to-left and left-to-right labels. */
+#define BIDI(c) (1u << bidi_##c)
+#define RTL_OK (BIDI(r) | BIDI(al) | BIDI(an) | BIDI(en) | BIDI(es) | BIDI(cs) \
+    | BIDI(et) | BIDI(on) | BIDI(bn) | BIDI(nsm))
+#define LTR_OK (BIDI(l) | BIDI(en) | BIDI(es) | BIDI(cs) | BIDI(et) | BIDI(on) \
+    | BIDI(bn) | BIDI(nsm))
+
+/*
+ * Statistics hooks, see punystats.c. They compile to nothing unless the library
+ * is built with PUNYCODE_STATS.
+ */
+#if defined(PUNYCODE_STATS)
+void punystats_input(size_t);
+void punystats_label(size_t, uint_least32_t, uint_least32_t);
+#define STATS_INPUT(bytes) punystats_input(bytes)
+#define STATS_LABEL(rval, cplen, ndistinct) \
+	punystats_label(rval, cplen, ndistinct)
+#else
+#define STATS_INPUT(bytes) ((void)0)
+#define STATS_LABEL(rval, cplen, ndistinct) ((void)0)
+#endif
+
+/*
+ * Profiling hook, see punyprof.c. It compiles to nothing unless the library is
+ * built with PUNYCODE_PROFILE. PUNYPROF_PHASES means the encoder is done.
+ */
+#if defined(PUNYCODE_PROFILE)
+void punyprof_phase(int);
+#define PROF_PHASE(phase) punyprof_phase(phase)
+#else
+#define PROF_PHASE(phase) ((void)0)
+#endif
+
+/*
+ * USDT probes for DTrace, bpftrace and perf. Unless the library is built with
+ * PUNYCODE_USDT, they compile to nothing. When they're compiled in, a disabled
+ * probe is a NOP instruction.
+ *
+ * punycode:label__entry(srclen, type)
+ *	The encoder starts on a label of srclen code units of the encoding type
+ *	(0 for UTF-8, 1 for UTF-16, 2 for UTF-32).
+ * punycode:label__return(cplen, rval, ndistinct)
+ *	The encoder returns rval for a label of cplen code points. ndistinct is
+ *	the amount of distinct non-basic code points it got through.
+ */
+#if defined(PUNYCODE_USDT)
+#include <sys/sdt.h>
+#else
+#define DTRACE_PROBE2(provider, name, a, b) ((void)0)
+#define DTRACE_PROBE3(provider, name, a, b, c) ((void)0)
+#endif
+
+/*
+ * Kernels, the loops that benefit from wider vectors. With GCC and Clang on x86,
+ * they're compiled once per instruction set with the target attribute and the
+ * best set the CPU supports is picked when the library is loaded, see
+ * pickkernels(). Elsewhere, only the scalar ones exist.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DISPATCH
+#define KERNEL static inline __attribute__((always_inline))
+#else
+#define KERNEL static
+#endif
+
+/* ACE prefix of IDNA labels. */
+static const char acepfx[] = "xn--";
+
+/*
+ * Instead of writing the punycode to dst, the encoder can hand it to a sink
+ * byte by byte. i is the byte's position in the punycode. If put() returns
+ * non-zero, the encoder stops and returns (size_t)-3.
+ */
+struct sink {
+	int (*put)(struct sink *, size_t i, unsigned char c);
+};
+
+struct cmpsink {
+	struct sink sink;
+	const unsigned char *ace;
+	int diff;
+};
+
+/*
+ * Mixed-case annotation, see punyenc_case() and punydec_case(). The basic code
+ * points are folded to lower case, except that the encoder writes them in upper
+ * case if their flag is set.
+ */
+struct casing {
+	const unsigned char *in;	/* Encoder flags or NULL. */
+	unsigned char *out;		/* Decoder flags or NULL. */
+	size_t nout;			/* Room in out. */
+};
+
+/*
+ * State of the IDNA2008 validator of punyenc_idna(). bootenc() feeds it every
+ * code point of a U-label with idnacp() in the pass that copies the basic code
+ * points, then idnaend() checks what needs the whole label. The Bidi rule only
+ * applies if a label of the hostname is right-to-left, which is only known at
+ * the end.
+ */
+struct idna {
+	int reason;		/* PUNYIDNA_OK until a check fails. */
+	int rtl;		/* A label has R, AL or AN code points. */
+	int bidiok;		/* Every U-label passes the Bidi rule. */
+
+	/* The rest is about the current label. */
+	size_t n;		/* Code points so far. */
+	uint_least32_t prev;	/* The last code point, or 0. */
+	uint_least16_t prevprops;
+	unsigned char lastjoin;	/* Joining type of the last code point not T. */
+	unsigned char want;	/* What the next code point must be, WANT_*. */
+	unsigned char flags;	/* HAS_*. */
+	unsigned char first;	/* Bidi class of the first code point. */
+	unsigned char last;	/* Bidi class of the last code point not NSM. */
+	unsigned bidiset;	/* Bidi classes seen, a bit each. */
+};
+
+/*
+ * State of punyenc_spans(). The basic code points and the delimiter are handed
+ * out before the encoder runs, the sink only buffers the rest.
+ */
+struct spansink {
+	struct sink sink;
+	size_t skip;		/* Basic code points and delimiter. */
+	int (*fn)(void *, const char *, size_t);
+	void *arg;
+	size_t n;
+	char buf[64];
 };
 
+/*
+ * State of punyhash(), a hash in the style of wyhash: every 16 byte block is
+ * mixed into h with a 64x64->128 bit multiplication. The bytes are buffered so
+ * that they can be fed one at a time.
+ */
+struct hashsink {
+	struct sink sink;
+	uint_least64_t h;
+	size_t len;
+	unsigned char buf[16];
+};
+
+/*
+ * Labels of punyenc_batch_lanes() in structure of arrays form: element l of
+ * every array belongs to the label in lane l, so that the loops over the lanes
+ * can be vectorized. cp[j][l] is code point j of that label, or 0 past its end.
+ * The other members are the state of bootenc().
+ */
+struct lanes {
+	uint32_t cp[lanecp][lanes];
+	uint32_t len[lanes];		/* In code points. */
+	uint32_t h[lanes];
+	uint32_t b[lanes];
+	uint32_t n[lanes];
+	uint32_t m[lanes];
+	uint32_t delta[lanes];
+	uint32_t bias[lanes];
+	uint32_t ndistinct[lanes];
+	size_t outlen[lanes];
+	unsigned char out[lanes][laneout];
+};
+
+struct kernels {
+	const char *name;
+	int (*allascii)(const unsigned char *, const unsigned char *);
+	size_t (*u8tocps)(uint_least32_t *restrict,
+	    const unsigned char *restrict, size_t);
+	void (*lanes)(struct lanes *, int);
+	int (*digits)(unsigned char *restrict, const unsigned char *restrict,
+	    size_t);
+	size_t (*deltas)(uint_least32_t *restrict, unsigned char *restrict,
+	    uint_least32_t *restrict, const uint_least32_t *restrict, size_t);
+};
+
+static size_t encode(unsigned char *restrict, const void *restrict, size_t,
+    int, size_t, size_t, struct sink *, const struct casing *, struct idna *);
+static size_t decode(void *restrict, int, const unsigned char *restrict,
+    const unsigned char *, size_t, const struct casing *);
+static size_t hostenc(unsigned char *restrict, const unsigned char *restrict,
+    size_t, int, struct idna *);
+static size_t bootenc(unsigned char *restrict, const void *restrict, size_t,
+    int, size_t, size_t, struct sink *, const struct casing *, struct idna *);
+static void idnastart(struct idna *);
+static void idnacp(struct idna *, uint_least32_t);
+static void idnaend(struct idna *);
+static uint_least16_t idnaprops(uint_least32_t);
+static int bidirule(int, int, unsigned);
+static int asciibidi(const unsigned char *, const unsigned char *);
+static size_t batchrow(unsigned char *restrict, size_t, size_t,
+    const unsigned char *restrict, const unsigned char *);
+static size_t asciirow(unsigned char *restrict, size_t, size_t,
+    const unsigned char *restrict, const unsigned char *);
+static int loadlane(struct lanes *, int, const unsigned char *,
+    const unsigned char *);
+KERNEL int allascii(const unsigned char *, const unsigned char *);
+KERNEL size_t u8tocps(uint_least32_t *restrict, const unsigned char *restrict,
+    size_t);
+KERNEL void encodelanes(struct lanes *, int);
+KERNEL int acedigits(unsigned char *restrict, const unsigned char *restrict,
+    size_t);
+KERNEL size_t maskdeltas(uint_least32_t *restrict, unsigned char *restrict,
+    uint_least32_t *restrict, const uint_least32_t *restrict, size_t);
+KERNEL int popcount(uint_least64_t);
+static void emitlane(struct lanes *, int);
+static int cmpput(struct sink *, size_t, unsigned char);
+static int spanput(struct sink *, size_t, unsigned char);
+static int hashput(struct sink *, size_t, unsigned char);
+static void hashinit(struct hashsink *, uint_least64_t);
+static uint_least64_t hashblock(uint_least64_t, const unsigned char *);
+static uint_least64_t hashfinal(struct hashsink *);
+static uint_least64_t mum(uint_least64_t, uint_least64_t);
+static int asciicasecmp(const unsigned char *, const unsigned char *, size_t);
+static unsigned char lower(unsigned char);
+static unsigned char upper(unsigned char);
+static size_t bootdec(void *restrict, int, const unsigned char *restrict,
+    const unsigned char *, size_t, const struct casing *);
+static size_t insert(void *, int, size_t, size_t, size_t [static 2], size_t,
+    uint_least32_t);
+static uint_least32_t nextcp(const void *, size_t *, size_t, int);
+static int units(uint_least32_t [static 4], uint_least32_t, int);
+static int cpunits(uint_least32_t, int);
+static int seqlen(uint_least32_t, int);
+static size_t unitsize(int);
+static uint_least32_t getunit(const void *, int, size_t);
+static void putunit(void *, int, size_t, uint_least32_t);
 static int utf8dec_unsafe(uint_least32_t [restrict static 1],
-    const char [restrict static 1]);
+    const unsigned char *restrict, const unsigned char *);
+static int utf8enc(unsigned char [static 4], uint_least32_t);
+static int utf8len(uint_least32_t);
+static void nulterm(void *, int, size_t, size_t);
 static unsigned char encode_digit(uint_least32_t);
 static uint_least32_t adapt(uint_least32_t, uint_least32_t, int);
 
-/* punyenc: punycode encoder
- * Encodes at most dstlen-1 bytes to _dst, terminating _dst with '\0' if
- * dstlen > 0. Returns the total length of the string it tried to create if the
- * input wasn't too long, (size_t)-1 otherwise.
+#define KERNELS(isa, target)						\
+static target int							\
+isa##_allascii(const unsigned char *p, const unsigned char *end)	\
+{									\
+	return allascii(p, end);					\
+}									\
+static target size_t							\
+isa##_u8tocps(uint_least32_t *restrict cps,				\
+    const unsigned char *restrict src, size_t srclen)			\
+{									\
+	return u8tocps(cps, src, srclen);				\
+}									\
+static target void							\
+isa##_lanes(struct lanes *ln, int nl)					\
+{									\
+	encodelanes(ln, nl);						\
+}									\
+static target int							\
+isa##_digits(unsigned char *restrict dig,				\
+    const unsigned char *restrict src, size_t len)			\
+{									\
+	return acedigits(dig, src, len);				\
+}									\
+static target size_t							\
+isa##_deltas(uint_least32_t *restrict delta,				\
+    unsigned char *restrict idx, uint_least32_t *restrict ndistinct,	\
+    const uint_least32_t *restrict cps, size_t ncp)			\
+{									\
+	return maskdeltas(delta, idx, ndistinct, cps, ncp);		\
+}
+
+KERNELS(scalar, )
+#if defined(DISPATCH)
+KERNELS(sse42, __attribute__((target("sse4.2"))))
+KERNELS(avx2, __attribute__((target("avx2"))))
+KERNELS(avx512, __attribute__((target("avx512f,avx512bw"))))
+#endif
+#undef KERNELS
+
+/* From the worst to the best. */
+static const struct kernels kernels[] = {
+	{"scalar", scalar_allascii, scalar_u8tocps, scalar_lanes,
+	    scalar_digits, scalar_deltas},
+#if defined(DISPATCH)
+	{"sse4.2", sse42_allascii, sse42_u8tocps, sse42_lanes, sse42_digits,
+	    sse42_deltas},
+	{"avx2", avx2_allascii, avx2_u8tocps, avx2_lanes, avx2_digits,
+	    avx2_deltas},
+	{"avx512", avx512_allascii, avx512_u8tocps, avx512_lanes,
+	    avx512_digits, avx512_deltas},
+#endif
+};
+
+static const struct kernels *kern = &kernels[0];
+
+#if defined(DISPATCH)
+/* pickkernels: pick the kernels when the library is loaded
+ * Picks the best kernels the CPU supports, or the ones named by the
+ * PUNYCODE_ISA environment variable if the CPU supports them.
+ */
+__attribute__((constructor)) static void
+pickkernels(void)
+{
+	const char *isa;
+	size_t i;
+	size_t best;
+
+	__builtin_cpu_init();
+	best = 0;
+	if (__builtin_cpu_supports("sse4.2"))
+		best = 1;
+	if (best == 1 && __builtin_cpu_supports("avx2"))
+		best = 2;
+	if (best == 2 && __builtin_cpu_supports("avx512f")
+	    && __builtin_cpu_supports("avx512bw"))
+		best = 3;
+
+	if ((isa = getenv("PUNYCODE_ISA")) != NULL) {
+		for (i = 0; i <= best; i++) {
+			if (strcmp(isa, kernels[i].name) == 0)
+				best = i;
+		}
+	}
+	kern = &kernels[best];
+}
+#endif
+
+/* punyisa: returns the name of the kernels the library uses
+ * The name is "scalar", "sse4.2", "avx2" or "avx512".
+ */
+const char *
+punyisa(void)
+{
+	return kern->name;
+}
+
+/* punyenc: punycode encoder
+ * Encodes at most dstlen-1 bytes to _dst, terminating _dst with '\0' if
+ * dstlen > 0. Returns the total length of the string it tried to create if the
+ * input wasn't too long, (size_t)-1 otherwise.
+ *
+ * Set _dst to NULL and dstlen to 0 to get the return value without writing
+ * anything.
+ *
+ * No validation is done. Don't pass invalid UTF-8 input to the encoder.
+ *
+ * This interface is modeled after strlcpy(). The usage is the exact same,
+ * except for the possible (size_t)-1 return value which indicates that the
+ * input was too large to be encodable.
+ */
+size_t
+punyenc(char *restrict _dst, const char _src[restrict static 1],
+    size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	const unsigned char *src = (const unsigned char *)_src;
+	size_t rval;
+
+	rval = encode(dst, src, strlen(_src), utf_8, dstsize, -1, NULL, NULL,
+	    NULL);
+	nulterm(dst, utf_8, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punyenc_cap: punycode encoder with an output length cap
+ * Same as punyenc(), except that it gives up as soon as the punycode is known
+ * to be longer than maxlen bytes and returns (size_t)-2. Giving up doesn't wait
+ * for the whole input to be read, the work done is bounded by maxlen instead of
+ * the length of src.
+ *
+ * dst holds "" if the function gave up.
+ */
+size_t
+punyenc_cap(char *restrict _dst, const char _src[restrict static 1],
+    size_t dstsize, size_t maxlen)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	const unsigned char *src = (const unsigned char *)_src;
+	size_t srclen;
+	size_t maxsrc;
+	size_t rval;
+
+	/*
+	 * A codepoint is at most 4 bytes of UTF-8 and at least 1 byte of
+	 * punycode.
+	 */
+	maxsrc = maxlen < (size_t)-1 / 4 ? maxlen * 4 : (size_t)-1 - 1;
+	for (srclen = 0; srclen <= maxsrc && src[srclen] != '\0'; srclen++)
+		;
+	if (srclen > maxsrc)
+		rval = -2;
+	else
+		rval = encode(dst, src, srclen, utf_8, dstsize, maxlen, NULL,
+		    NULL, NULL);
+	nulterm(dst, utf_8, rval >= (size_t)-2 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punydec: punycode decoder
+ * Decodes at most dstsize-1 bytes of UTF-8 to _dst, terminating _dst with '\0'
+ * if dstsize > 0. Returns the total length of the string it tried to create if
+ * the input was valid punycode, (size_t)-1 otherwise.
+ *
+ * Unlike the encoder, the decoder validates its input: it's safe to pass
+ * untrusted data to it. The case of the basic code points is preserved.
+ *
+ * The interface is the same as punyenc()'s.
+ */
+size_t
+punydec(char *restrict _dst, const char _src[restrict static 1],
+    size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	const unsigned char *src = (const unsigned char *)_src;
+	size_t rval;
+
+	rval = decode(dst, utf_8, src, src + strlen(_src),
+	    dstsize > 0 ? dstsize-1 : 0, NULL);
+	nulterm(dst, utf_8, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punyenc_case: punycode encoder with mixed-case annotation
+ * Same as punyenc(), but encodes the case flags of RFC 3492 appendix A. flags
+ * has one element per code point of _src, a nonzero flag asks for the code
+ * point to be shown in uppercase: basic code points are written in the case
+ * their flag asks for, the others get their flag in the case of the last digit
+ * of their delta.
+ *
+ * If flags is NULL, every flag is 0: the basic code points are folded to
+ * lowercase, which makes the output the same as punyenc()'s on the lowercased
+ * input without a separate pass over it.
+ */
+size_t
+punyenc_case(char *restrict _dst, const char _src[restrict static 1],
+    const unsigned char *restrict flags, size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	const unsigned char *src = (const unsigned char *)_src;
+	struct casing cs = { .in = flags };
+	size_t rval;
+
+	rval = encode(dst, src, strlen(_src), utf_8, dstsize, -1, NULL, &cs,
+	    NULL);
+	nulterm(dst, utf_8, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punydec_case: punycode decoder with mixed-case annotation
+ * Same as punydec(), but reads the case flags of RFC 3492 appendix A instead of
+ * preserving the case of the basic code points, which are written in
+ * lowercase. If flags isn't NULL, it gets one element per code point of the
+ * result, 1 if the code point was shown in uppercase and 0 otherwise. It must
+ * have room for dstsize-1 elements, the flags of the code points that don't
+ * fit are dropped.
+ */
+size_t
+punydec_case(char *restrict _dst, const char _src[restrict static 1],
+    unsigned char *restrict flags, size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	const unsigned char *src = (const unsigned char *)_src;
+	struct casing cs = { .out = flags, .nout = dstsize > 0 ? dstsize-1 : 0 };
+	size_t rval;
+
+	rval = decode(dst, utf_8, src, src + strlen(_src),
+	    dstsize > 0 ? dstsize-1 : 0, &cs);
+	nulterm(dst, utf_8, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punyenc_u16: punycode encoder for UTF-16
+ * Same as punyenc(), but the input is a UTF-16 string terminated by a 0 code
+ * unit.
+ */
+size_t
+punyenc_u16(char *restrict _dst, const uint_least16_t src[restrict static 1],
+    size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	size_t srclen;
+	size_t rval;
+
+	for (srclen = 0; src[srclen] != 0; srclen++)
+		;
+	rval = encode(dst, src, srclen, utf_16, dstsize, -1, NULL, NULL, NULL);
+	nulterm(dst, utf_8, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punyenc_u32: punycode encoder for UTF-32
+ * Same as punyenc(), but the input is an array of codepoints terminated by a 0
+ * codepoint.
+ */
+size_t
+punyenc_u32(char *restrict _dst, const uint_least32_t src[restrict static 1],
+    size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	size_t srclen;
+	size_t rval;
+
+	for (srclen = 0; src[srclen] != 0; srclen++)
+		;
+	rval = encode(dst, src, srclen, utf_32, dstsize, -1, NULL, NULL, NULL);
+	nulterm(dst, utf_8, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punydec_u16: punycode decoder for UTF-16
+ * Same as punydec(), but the output is UTF-16 and dstsize and the return value
+ * are in code units.
+ */
+size_t
+punydec_u16(uint_least16_t *restrict dst, const char _src[restrict static 1],
+    size_t dstsize)
+{
+	const unsigned char *src = (const unsigned char *)_src;
+	size_t rval;
+
+	rval = decode(dst, utf_16, src, src + strlen(_src),
+	    dstsize > 0 ? dstsize-1 : 0, NULL);
+	nulterm(dst, utf_16, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punydec_u32: punycode decoder for UTF-32
+ * Same as punydec(), but the output is an array of codepoints and dstsize and
+ * the return value are in codepoints.
+ */
+size_t
+punydec_u32(uint_least32_t *restrict dst, const char _src[restrict static 1],
+    size_t dstsize)
+{
+	const unsigned char *src = (const unsigned char *)_src;
+	size_t rval;
+
+	rval = decode(dst, utf_32, src, src + strlen(_src),
+	    dstsize > 0 ? dstsize-1 : 0, NULL);
+	nulterm(dst, utf_32, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punyenc_wire: encode a hostname to the DNS wire format
+ * Splits the case-folded UTF-8 hostname in _src on '.' and writes it to dst as
+ * a sequence of RFC 1035 length-prefixed labels terminated by the root label.
+ * Labels that contain non-ASCII characters are written as "xn--" followed by
+ * their punycode, the others are copied. A trailing '.' is allowed, "" and "."
+ * are the root name.
+ *
+ * Writes at most dstsize bytes to dst, there is no '\0' terminator. Returns the
+ * length of the name it tried to create, or (size_t)-1 if the hostname has an
+ * empty label, a label longer than 63 octets, or is longer than 255 octets.
+ * A 255 byte dst is always large enough.
+ */
+size_t
+punyenc_wire(unsigned char *restrict dst, const char _src[restrict static 1],
+    size_t dstsize)
+{
+	return hostenc(dst, (const unsigned char *)_src, dstsize, 1, NULL);
+}
+
+/* punyenc_host: encode a hostname to ACE
+ * Same as punyenc_wire(), except that the hostname is written as text: the
+ * labels are separated by '.', a trailing '.' is kept, and dst is '\0'
+ * terminated like punyenc()'s. "" and "." are copied.
+ */
+size_t
+punyenc_host(char *restrict _dst, const char _src[restrict static 1],
+    size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	size_t rval;
+
+	rval = hostenc(dst, (const unsigned char *)_src, dstsize, 0, NULL);
+	nulterm(dst, utf_8, rval == (size_t)-1 ? 0 : rval, dstsize);
+	return rval;
+}
+
+/* punyenc_idna: encode a hostname to ACE if it's valid in IDNA2008
+ * Same as punyenc_host(), except that the labels that aren't made of ASCII
+ * alone are checked against IDNA2008 as they're encoded: the code points must
+ * be PVALID, or CONTEXTJ or CONTEXTO in their context, and the hyphen, leading
+ * combining mark and Bidi rules must hold. The tables are generated from
+ * Unicode IDNA_UNICODE by idnatab.py. The labels aren't checked for NFC.
+ *
+ * If reason isn't NULL, it's set to PUNYIDNA_OK, or to why the hostname was
+ * rejected.
+ */
+size_t
+punyenc_idna(char *restrict _dst, const char _src[restrict static 1],
+    size_t dstsize, int *reason)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	struct idna iv;
+	size_t rval;
+
+	iv.reason = PUNYIDNA_OK;
+	iv.rtl = 0;
+	iv.bidiok = 1;
+	rval = hostenc(dst, (const unsigned char *)_src, dstsize, 0, &iv);
+	if (rval == (size_t)-1 && iv.reason == PUNYIDNA_OK)
+		iv.reason = PUNYIDNA_SYNTAX;
+	nulterm(dst, utf_8, rval == (size_t)-1 ? 0 : rval, dstsize);
+	if (reason != NULL)
+		*reason = iv.reason;
+	return rval;
+}
+
+/* punyidna_label: check a U-label against IDNA2008
+ * Checks the case-folded UTF-8 label like punyenc_idna() does, the Bidi rule
+ * applies if the label is right-to-left. A label longer than 63 code points is
+ * PUNYIDNA_SYNTAX. Returns PUNYIDNA_OK, or why the label is invalid.
+ */
+int
+punyidna_label(const char _label[static 1])
+{
+	const unsigned char *label = (const unsigned char *)_label;
+	uint_least32_t cps[fastlen];
+	struct idna iv;
+	size_t len;
+	size_t i, n;
+
+	/* A code point takes at most 4 bytes. */
+	if ((len = strlen(_label)) > maxlabel * 4)
+		return PUNYIDNA_SYNTAX;
+	if ((n = kern->u8tocps(cps, label, len)) > maxlabel)
+		return PUNYIDNA_SYNTAX;
+
+	iv.reason = PUNYIDNA_OK;
+	iv.rtl = 0;
+	iv.bidiok = 1;
+	idnastart(&iv);
+	for (i = 0; i < n; i++)
+		idnacp(&iv, cps[i]);
+	idnaend(&iv);
+	if (iv.reason == PUNYIDNA_OK && iv.rtl && !iv.bidiok)
+		iv.reason = PUNYIDNA_BIDI;
+	return iv.reason;
+}
+
+/* punyenc_spans: punycode encoder with a callback
+ * Encodes the case-folded UTF-8 string in _src like punyenc(), but instead of
+ * writing the punycode to a buffer, calls fn(arg, span, len) with consecutive
+ * spans of it. The basic code points are handed out as spans of _src and the
+ * delimiter as a span of a string constant, without copying them. Only the
+ * rest of the punycode is encoded, into a small buffer which is handed out
+ * whenever it fills up; spans of it are only valid during the call to fn.
+ *
+ * If fn returns non-zero, encoding stops. Returns the length of the punycode,
+ * or (size_t)-1 on overflow or if fn stopped the encoder. fn may have been
+ * called in either case.
+ */
+size_t
+punyenc_spans(const char _src[static 1],
+    int (*fn)(void *, const char *, size_t), void *arg)
+{
+	const unsigned char *src = (const unsigned char *)_src;
+	struct spansink ss;
+	size_t len;
+	size_t start;
+	size_t rval;
+
+	/* Runs of ASCII bytes are runs of basic code points. */
+	ss.skip = 0;
+	for (len = 0; src[len] != '\0';) {
+		for (start = len; src[len] != '\0' && src[len] < 0x80; len++)
+			;
+		if (len > start) {
+			if (fn(arg, _src + start, len - start) != 0)
+				return -1;
+			ss.skip += len - start;
+		}
+		for (; src[len] >= 0x80; len++)
+			;
+	}
+	if (ss.skip > 0) {
+		if (fn(arg, "-", 1) != 0)
+			return -1;
+		ss.skip++;
+	}
+	if (ss.skip == len + 1)
+		return ss.skip;
+
+	ss.sink.put = spanput;
+	ss.fn = fn;
+	ss.arg = arg;
+	ss.n = 0;
+	rval = encode(NULL, src, len, utf_8, 0, -1, &ss.sink, NULL, NULL);
+	if (rval == (size_t)-1 || rval == (size_t)-3)
+		return -1;
+	if (ss.n > 0 && fn(arg, ss.buf, ss.n) != 0)
+		return -1;
+	return rval;
+}
+
+/* punycmp: compare a label with an ACE label
+ * Compares the ACE form of the case-folded UTF-8 label in _label, which is the
+ * label itself if it's made of ASCII alone or "xn--" followed by its punycode
+ * otherwise, with the ACE label in _ace, ignoring ASCII case. The punycode is
+ * compared as it's encoded, so the comparison stops at the first mismatch and
+ * no output is written anywhere.
+ *
+ * Returns an integer less than, equal to, or greater than 0 like strcasecmp().
+ * A label that can't be encoded is never equal.
+ */
+int
+punycmp(const char _label[static 1], const char _ace[static 1])
+{
+	const unsigned char *label = (const unsigned char *)_label;
+	const unsigned char *ace = (const unsigned char *)_ace;
+	struct cmpsink cs;
+	size_t len;
+	size_t rval;
+	int ascii;
+	int diff;
+
+	for (ascii = 1, len = 0; label[len] != '\0'; len++)
+		ascii &= label[len] < 0x80;
+	if (ascii)
+		return asciicasecmp(label, ace, -1);
+
+	if ((diff = asciicasecmp((const unsigned char *)acepfx, ace,
+	    sizeof(acepfx)-1)) != 0)
+		return diff;
+	cs.sink.put = cmpput;
+	cs.ace = ace + sizeof(acepfx)-1;
+	cs.diff = 0;
+	rval = encode(NULL, label, len, utf_8, 0, -1, &cs.sink, NULL, NULL);
+	if (rval == (size_t)-3)
+		return cs.diff;
+	if (rval == (size_t)-1)
+		return 1;
+	return -lower(cs.ace[rval]);
+}
+
+/* punyhash: hash the ACE form of a label
+ * Hashes the ACE form of the case-folded UTF-8 label in _label, see punycmp(),
+ * with the given seed. The punycode is hashed as it's encoded and isn't stored
+ * anywhere. Labels made of ASCII alone are hashed directly.
+ *
+ * Returns the same hash as punyhash_ace() of the ACE form. Labels that
+ * punycmp() considers equal have the same hash. A label that can't be encoded
+ * hashes like the empty label.
+ */
+uint_least64_t
+punyhash(const char _label[static 1], uint_least64_t seed)
+{
+	const unsigned char *label = (const unsigned char *)_label;
+	struct hashsink hs;
+	size_t len;
+	size_t i;
+	int ascii;
+
+	for (ascii = 1, len = 0; label[len] != '\0'; len++)
+		ascii &= label[len] < 0x80;
+	if (ascii)
+		return punyhash_ace(_label, seed);
+
+	hashinit(&hs, seed);
+	for (i = 0; i < sizeof(acepfx)-1; i++)
+		hashput(&hs.sink, i, acepfx[i]);
+	if (encode(NULL, label, len, utf_8, 0, -1, &hs.sink, NULL, NULL)
+	    == (size_t)-1)
+		return punyhash_ace("", seed);
+	return hashfinal(&hs);
+}
+
+/* punyhash_ace: hash an ACE label
+ * Hashes the ACE label in _ace with the given seed, ignoring ASCII case.
+ */
+uint_least64_t
+punyhash_ace(const char _ace[static 1], uint_least64_t seed)
+{
+	const unsigned char *ace = (const unsigned char *)_ace;
+	struct hashsink hs;
+	size_t len;
+
+	hashinit(&hs, seed);
+	len = strlen(_ace);
+	for (; hs.len + sizeof(hs.buf) <= len; hs.len += sizeof(hs.buf))
+		hs.h = hashblock(hs.h, ace + hs.len);
+	memcpy(hs.buf, ace + hs.len, len - hs.len);
+	hs.len = len;
+	return hashfinal(&hs);
+}
+
+/* punydec_wire: decode a hostname from the DNS wire format
+ * Reads the RFC 1035 name in the first srclen bytes of src and writes it to _dst
+ * as a '.' separated UTF-8 hostname without a trailing '.'. Labels that start
+ * with "xn--" in any case are punycode decoded, the others are copied. The root
+ * name is written as ".".
+ *
+ * Returns the length of the string it tried to create, or (size_t)-1 if the
+ * name is malformed, uses compression, a label holds a '.' or a '\0' that
+ * couldn't be told apart in the text, or a label is invalid punycode. The rest
+ * of the interface is the same as punydec()'s.
+ */
+size_t
+punydec_wire(char *restrict _dst, const unsigned char *restrict src,
+    size_t srclen, size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	const unsigned char *p;
+	size_t pos;
+	size_t i, j;
+	size_t len;
+	size_t room;
+
+	/* room is the size of dst minus the space for the '\0' terminator. */
+	room = dstsize > 0 ? dstsize-1 : 0;
+	i = 0;
+	for (pos = 0;; pos += 1 + len) {
+		if (pos >= srclen)
+			return -1; /* Missing root label. */
+		if ((len = src[pos]) == 0)
+			break;
+		if (len > maxlabel || len >= srclen - pos
+		    || pos + 1 + len >= maxname)
+			return -1;
+
+		if (i > 0) {
+			if (i < room)
+				dst[i] = '.';
+			i++;
+		}
+		p = src + pos + 1;
+		if (memchr(p, '.', len) != NULL || memchr(p, '\0', len) != NULL)
+			return -1;
+		if (len >= sizeof(acepfx)-1 && (p[0] | 0x20) == acepfx[0]
+		    && (p[1] | 0x20) == acepfx[1] && p[2] == acepfx[2]
+		    && p[3] == acepfx[3]) {
+			j = decode(i < room ? dst+i : NULL, utf_8,
+			    p + sizeof(acepfx)-1, p + len, i < room ? room-i : 0,
+			    NULL);
+			if (j == (size_t)-1)
+				return -1;
+			i += j;
+		} else {
+			for (j = 0; j < len; j++) {
+				if (i < room)
+					dst[i] = p[j];
+				i++;
+			}
+		}
+	}
+
+	if (i == 0) {
+		if (i < room)
+			dst[i] = '.';
+		i++;
+	}
+	nulterm(dst, utf_8, i, dstsize);
+	return i;
+}
+
+/* punydec_host: decode an ACE hostname
+ * Same as punydec_wire(), except that the hostname is read from the text in
+ * _src, like punyenc_host() writes it: the labels are separated by '.' and a
+ * trailing '.' is kept. "" and "." are copied. Returns (size_t)-1 if the
+ * hostname has an empty label, a label longer than 63 octets, is longer than
+ * 255 octets, or a label is invalid punycode.
+ */
+size_t
+punydec_host(char *restrict _dst, const char _src[restrict static 1],
+    size_t dstsize)
+{
+	unsigned char *dst = (unsigned char *)_dst;
+	const unsigned char *src = (const unsigned char *)_src;
+	const unsigned char *p;
+	const unsigned char *end;
+	size_t i, j;
+	size_t len;
+	size_t room;
+	size_t wirelen;
+
+	room = dstsize > 0 ? dstsize-1 : 0;
+	i = wirelen = 0;
+	if (strcmp(_src, ".") == 0) {
+		if (i < room)
+			dst[i] = '.';
+		nulterm(dst, utf_8, 1, dstsize);
+		return 1;
+	}
+	for (p = src; *p != '\0'; p = *end == '\0' ? end : end+1) {
+		for (end = p; *end != '\0' && *end != '.'; end++)
+			;
+		if ((len = end - p) == 0 || len > maxlabel)
+			return -1;
+		/* Leave space for the root label. */
+		wirelen += 1 + len;
+		if (wirelen >= maxname)
+			return -1;
+
+		if (p != src) {
+			if (i < room)
+				dst[i] = '.';
+			i++;
+		}
+		if (len >= sizeof(acepfx)-1 && (p[0] | 0x20) == acepfx[0]
+		    && (p[1] | 0x20) == acepfx[1] && p[2] == acepfx[2]
+		    && p[3] == acepfx[3]) {
+			j = decode(i < room ? dst+i : NULL, utf_8,
+			    p + sizeof(acepfx)-1, end, i < room ? room-i : 0,
+			    NULL);
+			if (j == (size_t)-1)
+				return -1;
+			i += j;
+		} else {
+			for (j = 0; j < len; j++) {
+				if (i < room)
+					dst[i] = p[j];
+				i++;
+			}
+		}
+	}
+
+	/* The trailing '.'. */
+	if (p != src && p[-1] == '.') {
+		if (i < room)
+			dst[i] = '.';
+		i++;
+	}
+	nulterm(dst, utf_8, i, dstsize);
+	return i;
+}
+
+/* punyenc_batch: encode a column of strings
+ * Encodes the n rows of a column laid out like an Apache Arrow string column:
+ * row i is the case-folded UTF-8 in data[offsets[i]] to data[offsets[i+1]], so
+ * offsets has n+1 elements. The rows are not '\0' terminated.
+ *
+ * The punycode of the rows is written to dst the same way, with its offsets in
+ * dstoffsets, which also has n+1 elements. If status isn't NULL, status[i] is
+ * set to PUNYBATCH_OK or to PUNYBATCH_ERROR if row i couldn't be encoded, in
+ * which case the row is empty.
+ *
+ * Writes at most dstsize bytes to dst, dstoffsets is always filled in. Returns
+ * the length of the column it tried to create, the output was truncated if it
+ * is > dstsize. Returns (size_t)-1 if the column is too long for 32-bit
+ * offsets.
+ */
+size_t
+punyenc_batch(const char *restrict _data, const uint32_t *restrict offsets,
+    size_t n, char *restrict _dst, size_t dstsize,
+    uint32_t *restrict dstoffsets, unsigned char *restrict status)
+{
+	const unsigned char *data = (const unsigned char *)_data;
+	unsigned char *dst = (unsigned char *)_dst;
+	size_t i;
+	size_t pos;
+	size_t len;
+
+	dstoffsets[0] = pos = 0;
+	for (i = 0; i < n; i++) {
+		len = batchrow(dst, pos, dstsize, data + offsets[i],
+		    data + offsets[i+1]);
+		if (status != NULL)
+			status[i] = len == (size_t)-1 ? PUNYBATCH_ERROR
+			    : PUNYBATCH_OK;
+		if (len == (size_t)-1)
+			len = 0;
+		if (len > UINT32_MAX - pos)
+			return -1;
+		pos += len;
+		dstoffsets[i+1] = pos;
+	}
+	return pos;
+}
+
+/* punydec_batch: decode a column of strings
+ * The interface is the same as punyenc_batch()'s, except that it decodes the
+ * punycode in data to UTF-8 in dst. PUNYBATCH_ERROR means that the row isn't
+ * valid punycode.
+ */
+size_t
+punydec_batch(const char *restrict _data, const uint32_t *restrict offsets,
+    size_t n, char *restrict _dst, size_t dstsize,
+    uint32_t *restrict dstoffsets, unsigned char *restrict status)
+{
+	const unsigned char *data = (const unsigned char *)_data;
+	unsigned char *dst = (unsigned char *)_dst;
+	size_t i;
+	size_t pos;
+	size_t len;
+
+	dstoffsets[0] = pos = 0;
+	for (i = 0; i < n; i++) {
+		len = decode(pos < dstsize ? dst + pos : NULL, utf_8,
+		    data + offsets[i], data + offsets[i+1],
+		    pos < dstsize ? dstsize - pos : 0, NULL);
+		if (status != NULL)
+			status[i] = len == (size_t)-1 ? PUNYBATCH_ERROR
+			    : PUNYBATCH_OK;
+		if (len == (size_t)-1)
+			len = 0;
+		if (len > UINT32_MAX - pos)
+			return -1;
+		pos += len;
+		dstoffsets[i+1] = pos;
+	}
+	return pos;
+}
+
+/* punyenc_batch_lanes: encode a column of strings several rows at once
+ * The interface and the output are the same as punyenc_batch()'s.
+ *
+ * The rows are taken lanes at a time. Those with non-ASCII code points and at
+ * most lanecp of them are encoded side by side by encodelanes(), the rest are
+ * encoded one by one like punyenc_batch() does.
+ */
+size_t
+punyenc_batch_lanes(const char *restrict _data,
+    const uint32_t *restrict offsets, size_t n, char *restrict _dst,
+    size_t dstsize, uint32_t *restrict dstoffsets,
+    unsigned char *restrict status)
+{
+	const unsigned char *data = (const unsigned char *)_data;
+	unsigned char *dst = (unsigned char *)_dst;
+	struct lanes ln;
+	int lane[lanes];
+	int nl;
+	size_t i, r;
+	size_t rows;
+	size_t pos;
+	size_t len;
+
+	dstoffsets[0] = pos = 0;
+	for (i = 0; i < n; i += rows) {
+		rows = n - i < lanes ? n - i : lanes;
+		for (nl = 0, r = 0; r < rows; r++) {
+			switch (loadlane(&ln, nl, data + offsets[i+r],
+			    data + offsets[i+r+1])) {
+			case 1:
+				lane[r] = nl++;
+				break;
+			case 0:
+				lane[r] = -1;
+				break;
+			default:
+				/* ASCII alone. */
+				lane[r] = -2;
+				break;
+			}
+		}
+		kern->lanes(&ln, nl);
+
+		for (r = 0; r < rows; r++) {
+			if (lane[r] == -2) {
+				len = asciirow(dst, pos, dstsize,
+				    data + offsets[i+r], data + offsets[i+r+1]);
+			} else if (lane[r] < 0) {
+				len = encode(pos < dstsize ? dst + pos : NULL,
+				    data + offsets[i+r],
+				    offsets[i+r+1] - offsets[i+r], utf_8,
+				    pos < dstsize ? dstsize - pos : 0, -1, NULL,
+				    NULL, NULL);
+			} else {
+				len = ln.outlen[lane[r]];
+				if (pos < dstsize) {
+					memcpy(dst + pos, ln.out[lane[r]],
+					    len < dstsize - pos ? len
+					    : dstsize - pos);
+				}
+			}
+			if (status != NULL)
+				status[i+r] = len == (size_t)-1
+				    ? PUNYBATCH_ERROR : PUNYBATCH_OK;
+			if (len == (size_t)-1)
+				len = 0;
+			if (len > UINT32_MAX - pos)
+				return -1;
+			pos += len;
+			dstoffsets[i+r+1] = pos;
+		}
+	}
+	return pos;
+}
+
+/* batchrow: encode the row [p, end) of a batch at position pos of dst
+ * Returns the length of its punycode, or (size_t)-1 if it can't be encoded.
+ */
+static size_t
+batchrow(unsigned char *restrict dst, size_t pos, size_t dstsize,
+    const unsigned char *restrict p, const unsigned char *end)
+{
+	if (kern->allascii(p, end))
+		return asciirow(dst, pos, dstsize, p, end);
+	return encode(pos < dstsize ? dst + pos : NULL, p, end - p, utf_8,
+	    pos < dstsize ? dstsize - pos : 0, -1, NULL, NULL, NULL);
+}
+
+/* asciirow: batchrow() for a row made of ASCII alone
+ * Pure ASCII is copied as is and followed by a delimiter.
+ */
+static size_t
+asciirow(unsigned char *restrict dst, size_t pos, size_t dstsize,
+    const unsigned char *restrict p, const unsigned char *end)
+{
+	size_t len;
+
+	len = end - p;
+	STATS_INPUT(len);
+	if (pos < dstsize)
+		memcpy(dst + pos, p, len < dstsize - pos ? len : dstsize - pos);
+	if (len > 0) {
+		if (pos + len < dstsize)
+			dst[pos + len] = '-';
+		len++;
+	}
+	STATS_LABEL(len, end - p, 0);
+	return len;
+}
+
+/* loadlane: decode the label [p, end) into lane l
+ * Returns 1 if it did, 0 if the label is too long for a lane, or -1 if it is
+ * made of ASCII alone. The code points past the end of the label are left for
+ * encodelanes() to clear.
+ */
+static int
+loadlane(struct lanes *ln, int l, const unsigned char *p,
+    const unsigned char *end)
+{
+	size_t pos;
+	uint32_t j;
+
+	if (kern->allascii(p, end))
+		return -1;
+
+	for (pos = j = 0; p + pos < end; j++) {
+		if (j == lanecp)
+			return 0;
+		ln->cp[j][l] = nextcp(p, &pos, end - p, utf_8);
+	}
+	DTRACE_PROBE2(punycode, label__entry, end - p, utf_8);
+	STATS_INPUT(end - p);
+	ln->len[l] = j;
+	return 1;
+}
+
+/* encodelanes: encode the labels in the first nl lanes
+ * Runs bootenc() on all of them at once. The minimum scan and the delta
+ * increments are done for every lane in the same loop, without branches, and
+ * the lanes whose code point j is the one being inserted emit their delta one
+ * at a time.
+ *
+ * The labels are so short that the state can't overflow: delta stays below
+ * lanecp * (0x1FFFFF + lanecp).
+ */
+KERNEL void
+encodelanes(struct lanes *ln, int nl)
+{
+	uint32_t maxlen;
+	uint32_t j;
+	uint32_t c;
+	uint32_t act;
+	size_t o;
+	int l;
+	int more;
+	int eq;
+
+	if (nl == 0)
+		return;
+	for (l = nl; l < lanes; l++)
+		ln->len[l] = 0;
+
+	/* First, copy the basic chars. */
+	for (maxlen = 0, l = 0; l < lanes; l++) {
+		for (o = j = 0; j < ln->len[l]; j++) {
+			if (ln->cp[j][l] < initial_n)
+				ln->out[l][o++] = ln->cp[j][l];
+		}
+		ln->h[l] = ln->b[l] = o;
+		if (o > 0)
+			ln->out[l][o++] = '-';
+		ln->outlen[l] = o;
+		ln->n[l] = initial_n;
+		ln->delta[l] = 0;
+		ln->bias[l] = initial_bias;
+		ln->ndistinct[l] = 0;
+		maxlen = ln->len[l] > maxlen ? ln->len[l] : maxlen;
+	}
+	for (l = 0; l < lanes; l++) {
+		for (j = ln->len[l]; j < maxlen; j++)
+			ln->cp[j][l] = 0;
+	}
+
+	for (;;) {
+		for (more = 0, l = 0; l < lanes; l++) {
+			ln->m[l] = UINT32_MAX;
+			more |= ln->h[l] < ln->len[l];
+		}
+		if (!more)
+			break;
+
+		/* Past the end of a label, cp is 0, which is below any n. */
+		PROF_PHASE(PUNYPROF_MINSCAN);
+		for (j = 0; j < maxlen; j++) {
+			for (l = 0; l < lanes; l++) {
+				c = ln->cp[j][l];
+				ln->m[l] = c >= ln->n[l] && c < ln->m[l] ? c
+				    : ln->m[l];
+			}
+		}
+		for (l = 0; l < lanes; l++) {
+			act = ln->h[l] < ln->len[l];
+			ln->delta[l] += act * (ln->m[l] - ln->n[l])
+			    * (ln->h[l] + 1);
+			ln->n[l] = act ? ln->m[l] : ln->n[l];
+			ln->ndistinct[l] += act;
+		}
+
+		PROF_PHASE(PUNYPROF_DELTA);
+		for (j = 0; j < maxlen; j++) {
+			for (eq = 0, l = 0; l < lanes; l++) {
+				c = ln->cp[j][l];
+				ln->delta[l] += c < ln->n[l] && j < ln->len[l];
+				eq |= c == ln->n[l];
+			}
+			if (!eq)
+				continue;
+			for (l = 0; l < lanes; l++) {
+				if (ln->cp[j][l] == ln->n[l])
+					emitlane(ln, l);
+			}
+		}
+		/* The lanes that were done before this round found no m. */
+		for (l = 0; l < lanes; l++) {
+			act = ln->m[l] != UINT32_MAX;
+			ln->delta[l] += act;
+			ln->n[l] += act;
+		}
+	}
+	PROF_PHASE(PUNYPROF_PHASES);
+	for (l = 0; l < nl; l++) {
+		STATS_LABEL(ln->outlen[l], ln->len[l], ln->ndistinct[l]);
+		DTRACE_PROBE3(punycode, label__return, ln->len[l],
+		    ln->outlen[l], ln->ndistinct[l]);
+	}
+}
+
+/* emitlane: write the delta of lane l and adapt its bias */
+static void
+emitlane(struct lanes *ln, int l)
+{
+	unsigned char *out = ln->out[l];
+	size_t o = ln->outlen[l];
+	uint32_t q, t, k;
+
+	for (q = ln->delta[l], k = base;; k += base) {
+		t = k <= ln->bias[l] ? tmin : k >= ln->bias[l] + tmax ? tmax
+		    : k - ln->bias[l];
+		if (q < t)
+			break;
+		out[o++] = encode_digit(t + (q - t) % (base - t));
+		q = (q - t) / (base - t);
+	}
+	out[o++] = encode_digit(q);
+	ln->outlen[l] = o;
+
+	PROF_PHASE(PUNYPROF_ADAPT);
+	ln->bias[l] = adapt(ln->delta[l], ln->h[l] + 1, ln->h[l] == ln->b[l]);
+	PROF_PHASE(PUNYPROF_DELTA);
+	ln->delta[l] = 0;
+	ln->h[l]++;
+}
+
+/* encode: punycode encoder
+ * Encodes srclen code units of src, which is in the encoding type, and writes at
+ * most dstsize bytes of the punycode to dst, without a '\0' terminator. Returns
+ * the length of the punycode, (size_t)-1 on overflow, or (size_t)-2 as soon as
+ * the punycode is known to be longer than maxlen.
+ *
+ * If sink isn't NULL, the punycode goes to the sink instead of dst, and
+ * (size_t)-3 is returned if the sink stops the encoder. If cs isn't NULL, the
+ * case of the basic code points and of the digits follows it. If iv isn't NULL,
+ * the code points are fed to the IDNA2008 validator, and (size_t)-1 is
+ * returned as soon as it fails.
+ *
+ * Short inputs are decoded to UTF-32 once so that the encoder doesn't decode
+ * them again on every pass.
+ */
+static size_t
+encode(unsigned char *restrict dst, const void *restrict src, size_t srclen,
+    int type, size_t dstsize, size_t maxlen, struct sink *sink,
+    const struct casing *cs, struct idna *iv)
+{
+	uint_least32_t cps[fastlen];
+	size_t pos;
+	size_t n;
+
+	DTRACE_PROBE2(punycode, label__entry, srclen, type);
+	STATS_INPUT(srclen * unitsize(type));
+	PROF_PHASE(PUNYPROF_DECODE);
+	if (type == utf_32 || srclen > fastlen)
+		return bootenc(dst, src, srclen, type, dstsize, maxlen, sink, cs,
+		    iv);
+
+	if (type == utf_8)
+		n = kern->u8tocps(cps, src, srclen);
+	else {
+		for (n = pos = 0; pos < srclen; n++)
+			cps[n] = nextcp(src, &pos, srclen, type);
+	}
+	return bootenc(dst, cps, n, utf_32, dstsize, maxlen, sink, cs, iv);
+}
+
+/* allascii: returns 1 if [p, end) is made of ASCII alone, 0 otherwise */
+KERNEL int
+allascii(const unsigned char *p, const unsigned char *end)
+{
+	unsigned char ascii;
+
+	for (ascii = 0; p < end; p++)
+		ascii |= *p;
+	return ascii < 0x80;
+}
+
+/* u8tocps: decode srclen bytes of UTF-8 to code points
+ * Returns the amount of code points. Runs of 16 ASCII bytes are widened at
+ * once.
+ */
+KERNEL size_t
+u8tocps(uint_least32_t *restrict cps, const unsigned char *restrict src,
+    size_t srclen)
+{
+	size_t n;
+	size_t pos;
+	size_t i;
+
+	for (n = pos = 0; pos < srclen;) {
+		if (src[pos] < 0x80 && srclen - pos >= 16
+		    && allascii(src + pos, src + pos + 16)) {
+			for (i = 0; i < 16; i++)
+				cps[n + i] = src[pos + i];
+			n += 16;
+			pos += 16;
+		} else {
+			cps[n++] = nextcp(src, &pos, srclen, utf_8);
+		}
+	}
+	return n;
+}
+
+/* acedigits: convert len punycode digits to their values
+ * The values of 'a' to 'z' in either case are 0 to 25, those of '0' to '9' are
+ * 26 to 35. Returns 1 if they're all digits, 0 otherwise. Bytes are converted
+ * without branches, 16 at once so that the loop is vectorized.
+ */
+KERNEL int
+acedigits(unsigned char *restrict dig, const unsigned char *restrict src,
+    size_t len)
+{
+	unsigned char bad = 0;
+	unsigned char l, d;
+	size_t i, j;
+
+	for (i = 0; len - i >= 16; i += 16) {
+		for (j = 0; j < 16; j++) {
+			/* Setting bit 5 folds the case of letters. */
+			l = (src[i+j] | 0x20) - 97u;
+			d = src[i+j] - 48u;
+			dig[i+j] = l < 26 ? l : d + 26;
+			bad |= (l >= 26) & (d >= 10);
+		}
+	}
+	for (; i < len; i++) {
+		l = (src[i] | 0x20) - 97u;
+		d = src[i] - 48u;
+		dig[i] = l < 26 ? l : d + 26;
+		bad |= (l >= 26) & (d >= 10);
+	}
+	return !bad;
+}
+
+/* maskdeltas: the deltas of a label of at most maskcp code points
+ * Computes what bootenc()'s delta loop would, without rescanning the label for
+ * every distinct non-basic code point: the positions of each one are a bit
+ * mask, and so are the positions of the code points below it, so the count of
+ * those before an occurrence is the popcount of the bits below it.
+ *
+ * Stores the delta of each non-basic code point in cps in the order bootenc()
+ * encodes them in delta, and its position in idx. Returns how many it stored,
+ * which is less than the non-basic code points if a delta overflows, and sets
+ * *ndistinct to the distinct ones it got through.
+ */
+KERNEL size_t
+maskdeltas(uint_least32_t *restrict delta, unsigned char *restrict idx,
+    uint_least32_t *restrict ndistinct, const uint_least32_t *restrict cps,
+    size_t ncp)
+{
+	uint_least32_t dcp[maskcp];	/* Non-basic code points, sorted. */
+	uint_least64_t dpos[maskcp];	/* Where each one is, a bit each. */
+	uint_least64_t below;		/* Where those below n are. */
+	uint_least64_t rest, occ, bit;
+	uint_least32_t n, d, h, cnt;
+	size_t nd, j, k, l;
+	size_t rval = 0;
+
+	below = 0;
+	for (nd = j = 0; j < ncp; j++) {
+		bit = (uint_least64_t)1 << j;
+		if (cps[j] < initial_n) {
+			below |= bit;
+			continue;
+		}
+		for (k = nd; k > 0 && dcp[k-1] > cps[j]; k--)
+			;
+		if (k > 0 && dcp[k-1] == cps[j]) {
+			dpos[k-1] |= bit;
+			continue;
+		}
+		for (l = nd++; l > k; l--) {
+			dcp[l] = dcp[l-1];
+			dpos[l] = dpos[l-1];
+		}
+		dcp[k] = cps[j];
+		dpos[k] = bit;
+	}
+
+	n = initial_n;
+	d = 0;
+	h = popcount(below);
+	for (*ndistinct = k = 0; k < nd; k++) {
+		if (dcp[k] - n > (UINT_LEAST32_MAX - d) / (h + 1))
+			return rval; /* Overflow. */
+		d += (dcp[k] - n) * (h + 1);
+		n = dcp[k];
+		++*ndistinct;
+
+		rest = below;
+		for (occ = dpos[k]; occ != 0; occ &= occ - 1) {
+			bit = occ & -occ;
+			cnt = popcount(rest & (bit - 1));
+			if (cnt > UINT_LEAST32_MAX - d)
+				return rval; /* Overflow. */
+			rest &= ~(bit - 1);
+			delta[rval] = d + cnt;
+			idx[rval++] = popcount(bit - 1);
+			d = 0;
+			h++;
+		}
+		if ((cnt = popcount(rest)) > UINT_LEAST32_MAX - d)
+			return rval; /* Overflow. */
+		d += cnt;
+		d++;
+		n++;
+		below |= dpos[k];
+	}
+	return rval;
+}
+
+/* popcount: returns the amount of bits set in x */
+KERNEL int
+popcount(uint_least64_t x)
+{
+#if defined(__GNUC__)
+	return __builtin_popcountll(x);
+#else
+	int n;
+
+	for (n = 0; x != 0; x &= x - 1)
+		n++;
+	return n;
+#endif
+}
+
+/* decode: punycode decoder
+ * Decodes the punycode in [src, end) to the encoding type and writes at most
+ * dstsize code units of it to dst, without a '\0' terminator. If the result
+ * doesn't fit, dst holds its first dstsize code units. Returns the length of
+ * the result in code units, or (size_t)-1 if the input is invalid.
  *
- * Set _dst to NULL and dstlen to 0 to get the return value without writing
- * anything.
- *
- * No validation is done. Don't pass invalid UTF-8 input to the encoder.
+ * Short inputs are decoded to UTF-32 where inserting a codepoint doesn't
+ * require scanning the output, then converted to the requested encoding.
+ */
+static size_t
+decode(void *restrict dst, int type, const unsigned char *restrict src,
+    const unsigned char *end, size_t dstsize, const struct casing *cs)
+{
+	uint_least32_t cps[fastlen];
+	uint_least32_t u[4];
+	size_t i, j;
+	size_t n;
+	int k, l;
+
+	/*
+	 * The output never has more code points than the input has bytes.
+	 * Case flags are indexed by code point, so they take the slow path.
+	 */
+	if (type == utf_32 || (size_t)(end - src) > fastlen ||
+	    (cs != NULL && cs->out != NULL))
+		return bootdec(dst, type, src, end, dstsize, cs);
+
+	if ((n = bootdec(cps, utf_32, src, end, fastlen, cs)) == (size_t)-1)
+		return -1;
+	for (i = j = 0; j < n; j++) {
+		k = units(u, cps[j], type);
+		for (l = 0; l < k; l++) {
+			if (i < dstsize)
+				putunit(dst, type, i, u[l]);
+			i++;
+		}
+	}
+	return i;
+}
+
+/* hostenc: hostname encoder
+ * Encodes the hostname in src to dst in the DNS wire format if wire is
+ * non-zero, or as text otherwise, see punyenc_wire() and punyenc_host(). Writes
+ * at most dstsize bytes to dst, without a '\0' terminator. Returns the length
+ * of the name, or (size_t)-1 if it isn't a valid hostname.
  *
- * This interface is modeled after strlcpy(). The usage is the exact same,
- * except for the possible (size_t)-1 return value which indicates that the
- * input was too large to be encodable.
+ * If iv isn't NULL, the U-labels are checked against IDNA2008 as they're
+ * encoded, and (size_t)-1 is returned if one fails, see punyenc_idna().
  */
-size_t
-punyenc(char *restrict _dst, const char _src[restrict static 1],
-    size_t dstsize)
+static size_t
+hostenc(unsigned char *restrict dst, const unsigned char *restrict src,
+    size_t dstsize, int wire, struct idna *iv)
+{
+	const unsigned char *p;
+	const unsigned char *end;
+	size_t i, j;
+	size_t hdr;
+	size_t len;
+	size_t wirelen;
+	int ascii;
+
+	if (src[0] == '.' && src[1] == '\0') {
+		if (dstsize > 0)
+			dst[0] = wire ? 0 : '.';
+		return 1;
+	}
+
+	i = wirelen = 0;
+	for (p = src; *p != '\0'; p = *end == '\0' ? end : end+1) {
+		ascii = 1;
+		for (end = p; *end != '\0' && *end != '.'; end++)
+			ascii &= *end < 0x80;
+		if (end == p)
+			return -1; /* Empty label. */
+
+		/*
+		 * Every label is preceded by its length octet in the wire
+		 * format, and every label but the first by a '.' in text.
+		 */
+		hdr = i;
+		if (wire || p != src)
+			i++;
+
+		if (ascii) {
+			len = end - p;
+			STATS_INPUT(len);
+			STATS_LABEL(len > maxlabel ? (size_t)-2 : len, len, 0);
+			for (j = 0; j < len && j < maxlabel; j++) {
+				if (i+j < dstsize)
+					dst[i+j] = p[j];
+			}
+		} else {
+			for (j = 0; j < sizeof(acepfx)-1; j++) {
+				if (i+j < dstsize)
+					dst[i+j] = acepfx[j];
+			}
+			j += i;
+			if (iv != NULL)
+				idnastart(iv);
+			len = encode(j < dstsize ? dst+j : NULL, p, end - p,
+			    utf_8, j < dstsize ? dstsize-j : 0,
+			    maxlabel - (sizeof(acepfx)-1), NULL, NULL, iv);
+			if (len == (size_t)-1 || len == (size_t)-2)
+				return -1;
+			if (iv != NULL) {
+				idnaend(iv);
+				if (iv->reason != PUNYIDNA_OK)
+					return -1;
+			}
+			len += sizeof(acepfx)-1;
+		}
+		if (len > maxlabel)
+			return -1;
+		if (hdr < i && hdr < dstsize)
+			dst[hdr] = wire ? len : '.';
+		i += len;
+
+		/* Leave space for the root label. */
+		wirelen += 1 + len;
+		if (wirelen >= maxname)
+			return -1;
+	}
+
+	/*
+	 * The hostname is right-to-left, so the Bidi rule applies to every
+	 * label. The ASCII labels weren't checked yet.
+	 */
+	if (iv != NULL && iv->rtl) {
+		if (!iv->bidiok)
+			iv->reason = PUNYIDNA_BIDI;
+		for (p = src; *p != '\0' && iv->reason == PUNYIDNA_OK;
+		    p = *end == '\0' ? end : end+1) {
+			for (end = p; *end != '\0' && *end != '.'; end++)
+				;
+			if (kern->allascii(p, end) && !asciibidi(p, end))
+				iv->reason = PUNYIDNA_BIDI;
+		}
+		if (iv->reason != PUNYIDNA_OK)
+			return -1;
+	}
+
+	/* The root label. */
+	if (wire || (p != src && p[-1] == '.')) {
+		if (i < dstsize)
+			dst[i] = wire ? 0 : '.';
+		i++;
+	}
+	return i;
+}
+
+/* idnastart: start validating a U-label */
+static void
+idnastart(struct idna *v)
+{
+	v->n = 0;
+	v->prev = 0;
+	v->prevprops = 0;
+	v->lastjoin = join_u;
+	v->want = v->flags = 0;
+	v->bidiset = 0;
+}
+
+/* idnacp: validate the next code point of a U-label
+ * Checks the rules of RFC 5891 section 4.2.3 and the contextual rules of RFC
+ * 5892 appendix A that can be checked with the code points seen so far, and
+ * gathers what idnaend() needs for the rest.
+ */
+static void
+idnacp(struct idna *v, uint_least32_t cp)
+{
+	uint_least16_t p;
+	int join;
+	int bidi;
+
+	if (v->reason != PUNYIDNA_OK)
+		return;
+	p = idnaprops(cp);
+	join = PROP_JOIN(p);
+	bidi = PROP_BIDI(p);
+
+	if (v->want != 0) {
+		if ((v->want & WANT_L) && cp != 'l')
+			v->reason = PUNYIDNA_CONTEXTO;
+		if ((v->want & WANT_GREEK) && PROP_SCRIPT(p) != script_greek)
+			v->reason = PUNYIDNA_CONTEXTO;
+		v->want &= ~(WANT_L | WANT_GREEK);
+		if ((v->want & WANT_JOIN) && join != join_t) {
+			if (join != join_r && join != join_d)
+				v->reason = PUNYIDNA_CONTEXTJ;
+			v->want &= ~WANT_JOIN;
+		}
+		if (v->reason != PUNYIDNA_OK)
+			return;
+	}
+
+	switch (PROP_CLASS(p)) {
+	case idna_disallowed:
+		v->reason = PUNYIDNA_DISALLOWED;
+		return;
+	case idna_contextj:
+		/* ZWJ and ZWNJ may follow a virama. */
+		if (PROP_VIRAMA(v->prevprops))
+			break;
+		/* ZWNJ may be in (L|D) T* ZWNJ T* (R|D). */
+		if (cp == 0x200C && (v->lastjoin == join_l
+		    || v->lastjoin == join_d)) {
+			v->want |= WANT_JOIN;
+			break;
+		}
+		v->reason = PUNYIDNA_CONTEXTJ;
+		return;
+	case idna_contexto:
+		if (cp == 0xB7 && v->prev == 'l')
+			v->want |= WANT_L;
+		else if (cp == 0x375)
+			v->want |= WANT_GREEK;
+		else if ((cp == 0x5F3 || cp == 0x5F4)
+		    && PROP_SCRIPT(v->prevprops) == script_hebrew)
+			;
+		else if (cp == 0x30FB)
+			v->flags |= HAS_KATADOT;
+		else if (cp >= 0x660 && cp <= 0x669)
+			v->flags |= HAS_ARABDIG;
+		else if (cp >= 0x6F0 && cp <= 0x6F9)
+			v->flags |= HAS_EXTDIG;
+		else {
+			v->reason = PUNYIDNA_CONTEXTO;
+			return;
+		}
+		break;
+	}
+
+	if (v->n == 0) {
+		if (PROP_MARK(p)) {
+			v->reason = PUNYIDNA_COMBINING;
+			return;
+		}
+		if (cp == '-') {
+			v->reason = PUNYIDNA_HYPHEN;
+			return;
+		}
+		v->first = bidi;
+	} else if (cp == '-' && v->n == 2) {
+		v->flags |= HAS_HYPHEN3;
+	} else if (cp == '-' && v->n == 3 && (v->flags & HAS_HYPHEN3)) {
+		v->reason = PUNYIDNA_HYPHEN;
+		return;
+	}
+
+	v->bidiset |= 1u << bidi;
+	if (bidi != bidi_nsm)
+		v->last = bidi;
+	if (PROP_SCRIPT(p) >= script_hiragana)
+		v->flags |= HAS_KANA;
+	if (join != join_t)
+		v->lastjoin = join;
+	v->prev = cp;
+	v->prevprops = p;
+	v->n++;
+}
+
+/* idnaend: finish validating a U-label */
+static void
+idnaend(struct idna *v)
+{
+	if (v->reason != PUNYIDNA_OK)
+		return;
+	if (v->n == 0)
+		v->reason = PUNYIDNA_SYNTAX;
+	else if (v->prev == '-')
+		v->reason = PUNYIDNA_HYPHEN;
+	else if (v->want & WANT_JOIN)
+		v->reason = PUNYIDNA_CONTEXTJ;
+	else if (v->want != 0)
+		v->reason = PUNYIDNA_CONTEXTO;
+	else if ((v->flags & HAS_KATADOT) && !(v->flags & HAS_KANA))
+		v->reason = PUNYIDNA_CONTEXTO;
+	else if ((v->flags & HAS_ARABDIG) && (v->flags & HAS_EXTDIG))
+		v->reason = PUNYIDNA_CONTEXTO;
+
+	if (v->bidiset & (BIDI(r) | BIDI(al) | BIDI(an)))
+		v->rtl = 1;
+	if (!bidirule(v->first, v->last, v->bidiset))
+		v->bidiok = 0;
+}
+
+/* idnaprops: look up the IDNA2008 properties of a code point */
+static uint_least16_t
+idnaprops(uint_least32_t cp)
+{
+	if (cp >= IDNA_NCP)
+		return 0;
+	return idnaprop[idnablk[idnaidx[cp >> IDNA_SHIFT]][cp & IDNA_MASK]];
+}
+
+/* bidirule: the Bidi rule of RFC 5893 section 2
+ * first is the Bidi class of the first code point of the label, last that of
+ * the last code point that isn't NSM, and set has a bit for every class in the
+ * label. Returns 1 if the label passes, 0 otherwise.
+ */
+static int
+bidirule(int first, int last, unsigned set)
+{
+	if (first == bidi_r || first == bidi_al) {
+		return (set & ~RTL_OK) == 0 && (last == bidi_r
+		    || last == bidi_al || last == bidi_en || last == bidi_an)
+		    && (set & (BIDI(en) | BIDI(an))) != (BIDI(en) | BIDI(an));
+	}
+	if (first == bidi_l)
+		return (set & ~LTR_OK) == 0 && (last == bidi_l || last == bidi_en);
+	return 0;
+}
+
+/* asciibidi: the Bidi rule for the ASCII label [p, end) */
+static int
+asciibidi(const unsigned char *p, const unsigned char *end)
+{
+	unsigned set = 0;
+	int first, last;
+	int bidi;
+
+	first = last = bidi_other;
+	for (; p < end; p++) {
+		if ((*p | 0x20) >= 'a' && (*p | 0x20) <= 'z')
+			bidi = bidi_l;
+		else if (*p >= '0' && *p <= '9')
+			bidi = bidi_en;
+		else if (*p == '-')
+			bidi = bidi_es;
+		else
+			bidi = bidi_on;
+		if (set == 0)
+			first = bidi;
+		set |= 1u << bidi;
+		last = bidi;
+	}
+	return bidirule(first, last, set);
+}
+
+/*
+ * PUT writes a byte of punycode to dst if dst is large enough, or hands it to
+ * the sink, and counts it in i either way.
+ */
+#define PUT(c) do {							\
+	if (sink == NULL) {						\
+		if (i < dstsize)					\
+			dst[i] = (c);					\
+	} else if (sink->put(sink, i, (c)) != 0) {			\
+		rval = -3;						\
+		goto end;						\
+	}								\
+	i++;								\
+} while (0)
+
+/*
+ * PUTDELTA writes delta as a variable-length integer with the case flag of the
+ * code point at position idx, then adapts the bias to it.
+ */
+#define PUTDELTA(idx) do {						\
+	uint_least32_t q, t;						\
+									\
+	for (q = delta, k = base;; k += base) {				\
+		t = k <= bias ? tmin :					\
+		    k >= bias + tmax ? tmax : k - bias;			\
+		if (q < t)						\
+			break;						\
+		c = encode_digit(t + (q - t) % (base - t));		\
+		PUT(c);							\
+		q = (q - t) / (base - t);				\
+	}								\
+									\
+	/* The case flag goes in the last digit. */			\
+	c = encode_digit(q);						\
+	if (cs != NULL && cs->in != NULL && cs->in[idx])		\
+		c = upper(c);						\
+	PUT(c);								\
+	if (i > maxlen) {						\
+		rval = -2;						\
+		goto end;						\
+	}								\
+	PROF_PHASE(PUNYPROF_ADAPT);					\
+	bias = adapt(delta, h + 1, h == b);				\
+	PROF_PHASE(PUNYPROF_DELTA);					\
+	delta = 0;							\
+	h++;								\
+} while (0)
+
+/* bootenc: Bootstring encoder core
+ * The interface is the same as encode()'s.
+ */
+static size_t
+bootenc(unsigned char *restrict dst, const void *restrict src, size_t srclen,
+    int type, size_t dstsize, size_t maxlen, struct sink *sink,
+    const struct casing *cs, struct idna *iv)
 {
 	size_t i;
+	size_t pos;
 	uint_least32_t k;
-	unsigned char *src = (unsigned char *)_src;
-	unsigned char *p;
-	unsigned char *dst = (unsigned char *)_dst;
 	uint_least32_t h, b;
 	uint_least32_t n;
 	uint_least32_t delta;
 	uint_least32_t bias;
 	uint_least32_t m;
 	uint_least32_t codepoint;
-	uint_least32_t srclen;
-	int ret;
+	uint_least32_t cplen;
+	uint_least32_t ndistinct;
+	uint_least32_t deltas[maskcp];
+	unsigned char where[maskcp];
+	size_t idx;
+	size_t j, nd;
+	unsigned char c;
 	size_t rval = -1;
 
 	/* First, copy the basic chars. */
 	n = initial_n;
-	srclen = i = 0;
-	for (p = src; *p != '\0'; p += ret) {
-		ret = utf8dec_unsafe(&codepoint, p);
-		srclen++;
+	cplen = ndistinct = i = 0;
+	for (pos = 0; pos < srclen;) {
+		codepoint = nextcp(src, &pos, srclen, type);
+		if (iv != NULL)
+			idnacp(iv, codepoint);
+		/* Every codepoint takes at least 1 byte of punycode. */
+		if (++cplen > maxlen) {
+			rval = -2;
+			goto end;
+		}
 		if (codepoint < n) {
-			/*
-			 * The code reads: If dst is large enough, write the
-			 * punycode and calculate its strlen(), otherwise, only
-			 * calculate its strlen().
-			 *
-			 * The following 3 lines of code are used every time we
-			 * write to dst.
-			 */
-			if (i < dstsize)
-				dst[i] = *p;
-			i++;
+			if (cs != NULL) {
+				codepoint = cs->in != NULL && cs->in[cplen-1]
+				    ? upper(codepoint) : lower(codepoint);
+			}
+			PUT(codepoint);
 		}
 	}
+	if (iv != NULL && iv->reason != PUNYIDNA_OK)
+		goto end;
 	h = b = i;
-	if (i > 0) {
-		if (i < dstsize)
-			dst[i] = '-';
-		i++;
+	if (i > 0)
+		PUT('-');
+	if (i > maxlen) {
+		rval = -2;
+		goto end;
 	}
 
 	delta = 0;
 	bias = initial_bias;
-	while (h < srclen) {
-		uint_least32_t left, right, result;
-		for (m = UINT_LEAST32_MAX, p = src; *p != '\0';) {
-			p += utf8dec_unsafe(&codepoint, p);
+	if (type == utf_32 && srclen <= maskcp && h < cplen) {
+		/* Short labels get all their deltas at once. */
+		PROF_PHASE(PUNYPROF_MINSCAN);
+		nd = kern->deltas(deltas, where, &ndistinct, src, srclen);
+		PROF_PHASE(PUNYPROF_DELTA);
+		for (j = 0; j < nd; j++) {
+			delta = deltas[j];
+			PUTDELTA(where[j]);
+		}
+		if (h < cplen)
+			goto end; /* Overflow. */
+	}
+	while (h < cplen) {
+		PROF_PHASE(PUNYPROF_MINSCAN);
+		for (m = UINT_LEAST32_MAX, pos = 0; pos < srclen;) {
+			codepoint = nextcp(src, &pos, srclen, type);
 			if (codepoint >= n && codepoint < m)
 				m = codepoint;
 		}
-		left = m - n;
-		right = h + 1;
-		result = left * right;
-		if (left != 0 && result / left != right)
+		if (m - n > (UINT_LEAST32_MAX - delta) / (h + 1))
 			goto end; /* Overflow. */
-		delta += result;
+		delta += (m - n) * (h + 1);
 		n = m;
+		ndistinct++;
 
-		for (p = src; *p != '\0';) {
-			p += utf8dec_unsafe(&codepoint, p);
+		PROF_PHASE(PUNYPROF_DELTA);
+		for (idx = pos = 0; pos < srclen; idx++) {
+			codepoint = nextcp(src, &pos, srclen, type);
 			if (codepoint < n && ++delta == 0)
 				goto end; /* Overflow. */
-			if (codepoint == n) {
-				uint_least32_t q, t;
-				for (q = delta, k = base;; k += base) {
-					t = k <= bias ? tmin :
-					    k >= bias + tmax ? tmax : k - bias;
-					if (q < t)
-						break;
-					if (i < dstsize) {
-						dst[i] = encode_digit(
-						    t + (q - t) % (base - t));
-					}
-					i++;
-					q = (q - t) / (base - t);
-				}
-
-				if (i < dstsize)
-					dst[i] = encode_digit(q);
-				i++;
-				bias = adapt(delta, h + 1, h == b);
-				delta = 0;
-				h++;
-			}
+			if (codepoint == n)
+				PUTDELTA(idx);
 		}
 		delta++;
 		n++;
 	}
 	rval = i;
 end:
-	/* Make sure we don't i++ here to mirror strlcpy() behavior. */
-	if (i < dstsize)
-		dst[i] = '\0';
-	else if (dstsize > 0)
-		dst[dstsize-1] = '\0';
+	PROF_PHASE(PUNYPROF_PHASES);
+	STATS_LABEL(rval, cplen, ndistinct);
+	DTRACE_PROBE3(punycode, label__return, cplen, rval, ndistinct);
 	return rval;
 }
+#undef PUTDELTA
+#undef PUT
+
+/* bootdec: Bootstring decoder core
+ * The interface is the same as decode()'s.
+ */
+static size_t
+bootdec(void *restrict dst, int type, const unsigned char *restrict src,
+    const unsigned char *end, size_t dstsize, const struct casing *cs)
+{
+	const unsigned char *p;
+	const unsigned char *delim;
+	const unsigned char *blk;
+	unsigned char dig[digblock];
+	size_t ndig, di;
+	uint_least32_t n, i, oldi, w, k, t;
+	uint_least32_t digit;
+	uint_least32_t bias;
+	uint_least32_t out;
+	size_t len;
+	size_t used;
+	size_t cur[2];
+	size_t mv;
+	unsigned char c;
+
+	if ((size_t)(end - src) > UINT_LEAST32_MAX)
+		return -1;
+
+	/*
+	 * The basic code points are the ones before the last delimiter, there
+	 * are only digits after it.
+	 */
+	for (delim = end; delim > src && delim[-1] != '-'; delim--)
+		;
+	delim = delim > src ? delim-1 : NULL;
+	len = 0;
+	if (delim != NULL) {
+		if (!kern->allascii(src, delim))
+			return -1;
+		for (p = src; p < delim; p++) {
+			c = *p;
+			if (cs != NULL) {
+				if (cs->out != NULL && len < cs->nout)
+					cs->out[len] = c - 65u < 26;
+				c = lower(c);
+			}
+			if (len < dstsize)
+				putunit(dst, type, len, c);
+			len++;
+		}
+	}
+	out = len;
+	used = len < dstsize ? len : dstsize;
+
+	/*
+	 * Start just after the last delimiter if any basic code points were
+	 * copied, start at the beginning otherwise.
+	 */
+	n = initial_n;
+	i = 0;
+	bias = initial_bias;
+	cur[0] = cur[1] = 0;
+	blk = p = len > 0 ? delim+1 : src;
+	ndig = di = 0;
+	for (; di < ndig || p < end; out++) {
+		/*
+		 * Decode a generalized variable-length integer into i. Checking
+		 * for overflow is easier if we increase i as we go and subtract
+		 * its starting value at the end to obtain delta.
+		 */
+		for (oldi = i, w = 1, k = base;; k += base) {
+			if (di == ndig) {
+				/* Convert the next block of digits. */
+				if (p == end)
+					return -1;
+				ndig = (size_t)(end - p) < digblock ? end - p
+				    : digblock;
+				if (!kern->digits(dig, p, ndig))
+					return -1;
+				blk = p;
+				p += ndig;
+				di = 0;
+			}
+			digit = dig[di++];
+			if (digit > (UINT_LEAST32_MAX - i) / w)
+				return -1; /* Overflow. */
+			i += digit * w;
+			t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+			if (digit < t)
+				break;
+			if (w > UINT_LEAST32_MAX / (base - t))
+				return -1; /* Overflow. */
+			w *= base - t;
+		}
+		bias = adapt(i - oldi, out + 1, oldi == 0);
+
+		/*
+		 * i was supposed to wrap around from out+1 to 0, incrementing n
+		 * each time, so fix that now.
+		 */
+		if (i / (out + 1) > UINT_LEAST32_MAX - n)
+			return -1; /* Overflow. */
+		n += i / (out + 1);
+		i %= out + 1;
+
+		/* Surrogates and values past U+10FFFF can't be encoded. */
+		if (n > 0x10FFFF || (n >= 0xD800 && n <= 0xDFFF))
+			return -1;
+		len += cpunits(n, type);
+		used = insert(dst, type, dstsize, used, cur, i, n);
+
+		/* The case flag is in the last digit. */
+		if (cs != NULL && cs->out != NULL && i < cs->nout) {
+			mv = (out < cs->nout ? out : cs->nout - 1) - i;
+			memmove(cs->out + i + 1, cs->out + i, mv);
+			cs->out[i] = blk[di-1] - 65u < 26;
+		}
+		i++;
+	}
+	return len;
+}
+
+/* insert: insert a codepoint into a string in the encoding type.
+ *
+ * dst holds the first used code units of the string, at most dstsize. The
+ * codepoint is inserted before the idx-th codepoint of the string, code units
+ * pushed past dstsize are lost so that dst always holds a prefix of the whole
+ * string.
+ *
+ * cur caches the position of a codepoint to avoid rescanning the string from
+ * the start, cur[0] is the index of a codepoint and cur[1] its offset in code
+ * units. Zero it before the first call.
+ *
+ * Returns the new amount of code units held in dst.
+ */
+static size_t
+insert(void *dst, int type, size_t dstsize, size_t used,
+    size_t cur[static 2], size_t idx, uint_least32_t codepoint)
+{
+	uint_least32_t u[4];
+	size_t off;
+	size_t mv;
+	size_t sz;
+	int len;
+	int j;
+
+	if (idx < cur[0])
+		cur[0] = cur[1] = 0;
+	for (; cur[0] < idx && cur[1] < used; cur[0]++)
+		cur[1] += seqlen(getunit(dst, type, cur[1]), type);
+	off = cur[1];
+	if (cur[0] < idx || off >= dstsize)
+		return used; /* The codepoint goes past the end of dst. */
+
+	/* Move the rest of the string out of the way. */
+	len = units(u, codepoint, type);
+	mv = used - off;
+	if ((size_t)len >= dstsize - off)
+		mv = 0;
+	else if (mv > dstsize - off - len)
+		mv = dstsize - off - len;
+	sz = unitsize(type);
+	memmove((unsigned char *)dst + (off+len)*sz,
+	    (unsigned char *)dst + off*sz, mv*sz);
+	for (j = 0; j < len && off + j < dstsize; j++)
+		putunit(dst, type, off + j, u[j]);
+
+	cur[0] = idx + 1;
+	cur[1] = off + len;
+	used += len;
+	return used < dstsize ? used : dstsize;
+}
+
+/* nextcp: decode the codepoint at index *pos of src.
+ *
+ * src is srclen code units long and in the encoding type. Advances *pos past
+ * the codepoint. No validation is done, unpaired UTF-16 surrogates are returned
+ * as themselves.
+ */
+static uint_least32_t
+nextcp(const void *src, size_t *pos, size_t srclen, int type)
+{
+	const unsigned char *s8;
+	const uint_least16_t *s16;
+	uint_least32_t codepoint;
+	uint_least32_t lo;
+
+	switch (type) {
+	case utf_8:
+		s8 = src;
+		*pos += utf8dec_unsafe(&codepoint, s8 + *pos, s8 + srclen);
+		return codepoint;
+	case utf_16:
+		s16 = src;
+		codepoint = s16[(*pos)++] & 0xFFFF;
+		if (codepoint >= 0xD800 && codepoint < 0xDC00 && *pos < srclen
+		    && (lo = s16[*pos] & 0xFFFF) >= 0xDC00 && lo < 0xE000) {
+			(*pos)++;
+			codepoint = 0x10000 + ((codepoint - 0xD800) << 10)
+			    + (lo - 0xDC00);
+		}
+		return codepoint;
+	default:
+		return ((const uint_least32_t *)src)[(*pos)++];
+	}
+}
+
+/* units: encode a codepoint in the encoding type.
+ *
+ * Puts the code units in u, returns the amount of code units.
+ */
+static int
+units(uint_least32_t u[static 4], uint_least32_t codepoint, int type)
+{
+	unsigned char str[4];
+	int len;
+	int i;
+
+	switch (type) {
+	case utf_8:
+		len = utf8enc(str, codepoint);
+		for (i = 0; i < len; i++)
+			u[i] = str[i];
+		return len;
+	case utf_16:
+		if (codepoint < 0x10000) {
+			u[0] = codepoint;
+			return 1;
+		}
+		codepoint -= 0x10000;
+		u[0] = 0xD800 | (codepoint >> 10);
+		u[1] = 0xDC00 | (codepoint & 0x3FF);
+		return 2;
+	default:
+		u[0] = codepoint;
+		return 1;
+	}
+}
+
+/* cpunits: amount of code units of a codepoint in the encoding type */
+static int
+cpunits(uint_least32_t codepoint, int type)
+{
+	switch (type) {
+	case utf_8:
+		return utf8len(codepoint);
+	case utf_16:
+		return 1 + (codepoint >= 0x10000);
+	default:
+		return 1;
+	}
+}
+
+/* seqlen: amount of code units in the sequence that starts with unit */
+static int
+seqlen(uint_least32_t unit, int type)
+{
+	switch (type) {
+	case utf_8:
+		return 1 + (unit >= 0xC0) + (unit >= 0xE0) + (unit >= 0xF0);
+	case utf_16:
+		return 1 + (unit >= 0xD800 && unit < 0xDC00);
+	default:
+		return 1;
+	}
+}
+
+/* unitsize: size of a code unit of the encoding type */
+static size_t
+unitsize(int type)
+{
+	switch (type) {
+	case utf_8:
+		return 1;
+	case utf_16:
+		return sizeof(uint_least16_t);
+	default:
+		return sizeof(uint_least32_t);
+	}
+}
+
+static uint_least32_t
+getunit(const void *str, int type, size_t i)
+{
+	switch (type) {
+	case utf_8:
+		return ((const unsigned char *)str)[i];
+	case utf_16:
+		return ((const uint_least16_t *)str)[i];
+	default:
+		return ((const uint_least32_t *)str)[i];
+	}
+}
+
+static void
+putunit(void *str, int type, size_t i, uint_least32_t unit)
+{
+	switch (type) {
+	case utf_8:
+		((unsigned char *)str)[i] = unit;
+		break;
+	case utf_16:
+		((uint_least16_t *)str)[i] = unit;
+		break;
+	default:
+		((uint_least32_t *)str)[i] = unit;
+		break;
+	}
+}
 
 /* utf8dec_unsafe: decode utf8, assuming it is valid.
  *
  * Puts the codepoint in *codepoint.
  * Returns the amount of bytes in the utf-8 encoding.
  */
-static int utf8dec_unsafe(uint_least32_t codepoint[restrict static 1],
-    const char _str[restrict static 1])
+static int
+utf8dec_unsafe(uint_least32_t codepoint[restrict static 1],
+    const unsigned char *restrict str, const unsigned char *end)
 {
-	const unsigned char *str = _str;
 	int len;
 	int i;
 
@@ -191,11 +2396,11 @@ static int utf8dec_unsafe(uint_least32_t codepoint[restrict static 1],
 	i = 1;
 	do {
 		/*
-		 * Return if we run into a '\0' because the UTF-8 stream is
+		 * Return if we run into the end because the UTF-8 stream is
 		 * corrupted. This turns UB (buffer overread) into garbage in,
 		 * garbage out.
 		 */
-		if (str[i] == '\0')
+		if (str + i == end)
 			return i;
 		*codepoint <<= 6;
 		*codepoint |= str[i] & 0x3F;
@@ -203,6 +2408,183 @@ static int utf8dec_unsafe(uint_least32_t codepoint[restrict static 1],
 	return len;
 }
 
+/* utf8enc: encode a codepoint to utf8.
+ *
+ * Returns the amount of bytes written to str.
+ */
+static int
+utf8enc(unsigned char str[static 4], uint_least32_t codepoint)
+{
+	int len;
+	int i;
+
+	if (codepoint < 0x80) {
+		str[0] = codepoint;
+		return 1;
+	}
+	len = utf8len(codepoint);
+	for (i = len-1; i > 0; i--) {
+		str[i] = 0x80 | (codepoint & 0x3F);
+		codepoint >>= 6;
+	}
+	str[0] = (0xF00 >> len) | codepoint;
+	return len;
+}
+
+/* utf8len: length of the utf-8 encoding of a codepoint */
+static int
+utf8len(uint_least32_t codepoint)
+{
+	return 1 + (codepoint >= 0x80) + (codepoint >= 0x800)
+	    + (codepoint >= 0x10000);
+}
+
+/* nulterm: '\0' terminate a string of length len the same way strlcpy() does
+ *
+ * len and dstsize are in code units of the encoding type.
+ */
+static void
+nulterm(void *dst, int type, size_t len, size_t dstsize)
+{
+	if (len < dstsize)
+		putunit(dst, type, len, 0);
+	else if (dstsize > 0)
+		putunit(dst, type, dstsize-1, 0);
+}
+
+/* cmpput: the sink of punycmp(), stops at the first mismatch */
+static int
+cmpput(struct sink *sink, size_t i, unsigned char c)
+{
+	struct cmpsink *cs = (struct cmpsink *)sink;
+
+	/* If ace is shorter, its '\0' is the mismatch. */
+	cs->diff = lower(c) - lower(cs->ace[i]);
+	return cs->diff;
+}
+
+/* spanput: the sink of punyenc_spans(), hands out full buffers */
+static int
+spanput(struct sink *sink, size_t i, unsigned char c)
+{
+	struct spansink *ss = (struct spansink *)sink;
+
+	if (i < ss->skip)
+		return 0;
+	ss->buf[ss->n++] = c;
+	if (ss->n < sizeof(ss->buf))
+		return 0;
+	ss->n = 0;
+	return ss->fn(ss->arg, ss->buf, sizeof(ss->buf));
+}
+
+/* hashput: the sink of punyhash(), never stops */
+static int
+hashput(struct sink *sink, size_t i, unsigned char c)
+{
+	struct hashsink *hs = (struct hashsink *)sink;
+
+	(void)i;
+	hs->buf[hs->len++ % sizeof(hs->buf)] = c;
+	if (hs->len % sizeof(hs->buf) == 0)
+		hs->h = hashblock(hs->h, hs->buf);
+	return 0;
+}
+
+/* Secrets of wyhash. */
+static const uint_least64_t hashsecret[4] = {
+	0xa0761d6478bd642f, 0xe7037ed1a0b428db,
+	0x8ebc6af09c88c6e3, 0x589965cc75374cc3,
+};
+
+static void
+hashinit(struct hashsink *hs, uint_least64_t seed)
+{
+	hs->sink.put = hashput;
+	hs->h = seed ^ mum(seed ^ hashsecret[0], hashsecret[1]);
+	hs->len = 0;
+}
+
+/* hashblock: mix the 16 bytes at p into h, ignoring ASCII case */
+static uint_least64_t
+hashblock(uint_least64_t h, const unsigned char *p)
+{
+	uint_least64_t a, b;
+	int i;
+
+	for (a = b = 0, i = 0; i < 8; i++) {
+		a |= (uint_least64_t)lower(p[i]) << 8*i;
+		b |= (uint_least64_t)lower(p[8+i]) << 8*i;
+	}
+	return mum(a ^ hashsecret[1], b ^ h);
+}
+
+/* hashfinal: mix the buffered bytes and the length into the hash */
+static uint_least64_t
+hashfinal(struct hashsink *hs)
+{
+	size_t n = hs->len % sizeof(hs->buf);
+
+	/* Pad the last block with zeroes, the length tells them apart. */
+	memset(hs->buf + n, 0, sizeof(hs->buf) - n);
+	return mum(hashblock(hs->h, hs->buf) ^ hashsecret[2],
+	    hs->len ^ hashsecret[3]);
+}
+
+/* mum: multiply a and b to 128 bits and xor the halves */
+static uint_least64_t
+mum(uint_least64_t a, uint_least64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+	__extension__ typedef unsigned __int128 u128;
+	u128 r = (u128)a * b;
+
+	return (uint_least64_t)r ^ (uint_least64_t)(r >> 64);
+#else
+	const uint_least64_t m64 = 0xffffffffffffffff;
+	const uint_least64_t m32 = 0xffffffff;
+	uint_least64_t ah = a >> 32 & m32, al = a & m32;
+	uint_least64_t bh = b >> 32 & m32, bl = b & m32;
+	uint_least64_t rh = ah * bh, rm0 = ah * bl, rm1 = al * bh, rl = al * bl;
+	uint_least64_t t, lo, hi;
+	int c;
+
+	t = (rl + (rm0 << 32)) & m64;
+	c = t < rl;
+	lo = (t + (rm1 << 32)) & m64;
+	c += lo < t;
+	hi = (rh + (rm0 >> 32) + (rm1 >> 32) + c) & m64;
+	return lo ^ hi;
+#endif
+}
+
+/* asciicasecmp: strncasecmp() for ASCII that doesn't depend on the locale */
+static int
+asciicasecmp(const unsigned char *s1, const unsigned char *s2, size_t n)
+{
+	int diff;
+
+	for (; n > 0; n--, s1++, s2++) {
+		if ((diff = lower(*s1) - lower(*s2)) != 0 || *s1 == '\0')
+			return diff;
+	}
+	return 0;
+}
+
+/* lower: ASCII tolower() that doesn't depend on the locale */
+static unsigned char
+lower(unsigned char c)
+{
+	return c - 65u < 26 ? c + 32 : c;
+}
+
+/* upper: ASCII toupper() that doesn't depend on the locale */
+static unsigned char
+upper(unsigned char c)
+{
+	return c - 97u < 26 ? c - 32 : c;
+}
+
 static unsigned char
 encode_digit(uint_least32_t d)
 {
@@ -14,17 +14,95 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <sys/stat.h>
+
+#include <ctype.h>
 #include <err.h>
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <punycode.h>
 #include <unicase.h>
+#include <unictype.h>
 #include <uninorm.h>
+#include <unistr.h>
+
+/*
+ * USDT probes, see libpunycode.c. Each probe receives the length of the line
+ * after the step it's named after.
+ */
+#if defined(PUNYCODE_USDT)
+#include <sys/sdt.h>
+#else
+#define DTRACE_PROBE1(provider, name, a) ((void)(a))
+#endif
+
+static int punyutil(FILE *);
+static int framedutil(int, int, int);
+static int compileutil(const char *);
+static int fieldutil(FILE *, int, int, int);
+static const char *zonefield(const char *, const char *, const char **);
+static const char *nthfield(const char *, const char *, int, int,
+    const char **);
+static size_t foldfield(char **, size_t *, const char *, size_t);
+static int logutil(void);
+static const char *nonascii(const char *, const char *);
+static int rewriteline(const char *, const char *);
+static const char *hostend(const char *, const char *);
+static void ckptopen(const char *, uint_least64_t);
+static void checkpoint(FILE *);
+static void ckptreq(int);
+static void inforeq(int);
+static void lap(uint_least64_t *, struct timespec *);
+static double since(const struct timespec *, const struct timespec *);
+static void report(void);
+
+/* Precomputed encodings for punyenc_db(), see the -m option. */
+static const struct punydb *db;
+
+/* Co-process mode, see the -F option. */
+static int framed;
 
-static int punyutil(void);
+/*
+ * Checkpoints, see the -k option. SIGALRM asks for one every CKPTSECS seconds,
+ * the loops take it between lines.
+ */
+enum {CKPTSECS = 10};
+static struct {
+	const char *path;
+	char *tmppath;
+	uint_least64_t conf;	/* Hash of the options. */
+} ckpt;
+static volatile sig_atomic_t wantckpt;
+
+/*
+ * Statistics printed on SIGUSR1 or SIGINFO, and at exit with -s. Only 1 in
+ * SAMPLE encodings is timed, so the clock is read a fraction of a time per
+ * line.
+ * Bucket 0 of the histograms counts 0 ns, bucket i counts 2^(i-1) to 2^i - 1
+ * ns, and the last bucket counts everything past that.
+ */
+enum {SAMPLE = 16, LATBUCKETS = 24};
+static struct {
+	uint_least64_t lines;
+	uint_least64_t bytes;
+	uint_least64_t encodings;		/* Lines, fields or hostnames. */
+	uint_least64_t errors;
+	uint_least64_t fold[LATBUCKETS];	/* u8_tolower() */
+	uint_least64_t enc[LATBUCKETS];		/* The encoder. */
+	struct timespec start;
+	struct timespec last;			/* Of the last report. */
+	uint_least64_t lastbytes;
+} st;
+static volatile sig_atomic_t wantreport;
 
 /* punyenc: command line front-end to my punycode encoder.
  *
@@ -44,14 +122,59 @@ main(int argc, char *argv[])
 	};
 	char *value;
 	int ret;
+	const char *errstr;
+	int field = 0;
+	int delim = '\t';
+	int zone = 0;
+	int logs = 0;
+	int summary = 0;
+	struct sigaction sa;
+	const char *compile = NULL;
+	const char *dbpath = NULL;
+	const char *ckptpath = NULL;
+	char conf[64];
+	const char *p;
+	uint_least64_t h;
 
 #if defined(__OpenBSD__)
-	if (pledge("stdio", NULL) == -1)
+	/* fattr: compileutil() makes the database readable with fchmod(). */
+	if (pledge("stdio rpath wpath cpath fattr", NULL) == -1)
 		err(1, "pledge");
 #endif
 
-	while ((c = getopt(argc, argv, "D:")) != -1) {
+	while ((c = getopt(argc, argv, "c:D:d:Ff:k:lm:sz")) != -1) {
 		switch (c) {
+		case 'c':
+			compile = optarg;
+			break;
+		case 'd':
+			if (optarg[0] == '\0' || optarg[1] != '\0')
+				errx(1, "option -d: delimiter must be 1 byte");
+			delim = (unsigned char)optarg[0];
+			break;
+		case 'F':
+			framed = 1;
+			break;
+		case 'f':
+			field = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "option -f: field number is %s", errstr);
+			break;
+		case 'k':
+			ckptpath = optarg;
+			break;
+		case 'l':
+			logs = 1;
+			break;
+		case 'm':
+			dbpath = optarg;
+			break;
+		case 's':
+			summary = 1;
+			break;
+		case 'z':
+			zone = 1;
+			break;
 		case 'D': /* Secret debug options. Not for users. */
 			options = optarg;
 			while (*options) {
@@ -100,17 +223,83 @@ main(int argc, char *argv[])
 		}
 		exit(1);
 	}
+	if (!!field + zone + logs + !!compile > 1)
+		errx(1, "options -c, -f, -l and -z are mutually exclusive");
+	if (dbpath != NULL && !field && !zone && !logs)
+		errx(1, "option -m needs -f, -l or -z");
+	if (framed && (logs || compile != NULL))
+		errx(1, "option -F doesn't work with -c or -l");
+	if (ckptpath != NULL && (framed || logs || compile != NULL))
+		errx(1, "option -k doesn't work with -c, -F or -l");
+
+	/* SA_RESTART: the report waits for the line that is being read. */
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = inforeq;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	if (sigaction(SIGUSR1, &sa, NULL) == -1)
+		err(1, "sigaction");
+#if defined(SIGINFO)
+	if (sigaction(SIGINFO, &sa, NULL) == -1)
+		err(1, "sigaction");
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &st.start);
+	st.last = st.start;
+
+	if (compile != NULL) {
+		ret = compileutil(compile);
+		goto end;
+	}
+	if (dbpath != NULL && (db = punydb_open(dbpath)) == NULL)
+		err(1, "%s", dbpath);
+	if (ckptpath != NULL) {
+		/* The options that change the output, hashed with FNV-1a. */
+		(void)snprintf(conf, sizeof(conf), "f%d d%d z%d", field, delim,
+		    zone);
+		h = 0xcbf29ce484222325;
+		for (p = conf; *p != '\0'; p++)
+			h = ((h ^ (unsigned char)*p) * 0x100000001b3)
+			    & 0xffffffffffffffff;
+		ckptopen(ckptpath, h);
+	}
+#if defined(__OpenBSD__)
+	/* checkpoint() needs rpath too, mkstemp() opens with O_RDWR. */
+	if (pledge(ckptpath != NULL ? "stdio rpath wpath cpath" : "stdio",
+	    NULL) == -1)
+		err(1, "pledge");
+#endif
 
-	return punyutil();
+	if (framed)
+		ret = framedutil(field, delim, zone);
+	else if (logs)
+		ret = logutil();
+	else if (field || zone)
+		ret = fieldutil(stdin, field, delim, zone);
+	else
+		ret = punyutil(stdin);
+	if (ckpt.path != NULL) {
+		/* Lines that failed before a restart still count. */
+		checkpoint(stdin);
+		if (st.errors > 0)
+			ret = 1;
+	}
+	if (fflush(stdout) == EOF)
+		err(1, "fflush");
+end:
+	if (summary)
+		report();
+	return ret;
 }
 
+/* punyutil: encode every line of fp */
 static int
-punyutil(void)
+punyutil(FILE *fp)
 {
 	ssize_t inlen;
 	char *in;
 	char *fold;
 	char *out;
+	const char *src;
 	size_t insz;
 	size_t foldsz;
 	size_t outsz;
@@ -118,16 +307,46 @@ punyutil(void)
 	void *tmp;
 	size_t foldlen;
 	size_t outlen;
+	struct timespec t;
+	int timed;
 
 	in = fold = out = NULL;
 	insz = foldsz = outsz = 0;
 	for (;;) {
+		if (wantreport)
+			report();
+		if (wantckpt)
+			checkpoint(fp);
+
 		/* Read a line. */
-		if ((inlen = getline(&in, &insz, stdin)) == -1) {
-			if (feof(stdin))
-				return rval;
+		if ((inlen = getline(&in, &insz, fp)) == -1) {
+			if (feof(fp))
+				break;
 			err(1, "getline");
 		}
+		DTRACE_PROBE1(punycode, line__read, inlen);
+		st.lines++;
+		st.bytes += inlen;
+		if ((timed = st.encodings++ % SAMPLE == 0))
+			clock_gettime(CLOCK_MONOTONIC, &t);
+
+		/*
+		 * The last line may lack a newline, give it one in the room of
+		 * the '\0' terminator so that it's treated like the others.
+		 */
+		if (in[inlen-1] != '\n')
+			in[inlen++] = '\n';
+
+		/*
+		 * ASCII lines don't need to be canonicalized, the encoder
+		 * folds their case as it copies them.
+		 */
+		if (nonascii(in, in + inlen) == in + inlen) {
+			in[--inlen] = '\0';
+			DTRACE_PROBE1(punycode, line__fold, inlen);
+			src = in;
+			goto encode;
+		}
 
 		/*
 		 * Canonicalize and fold the case of the line.
@@ -160,12 +379,21 @@ punyutil(void)
 		 * left at the end of the string with a '\0'.
 		 */
 		fold[--foldlen] = '\0';
+		DTRACE_PROBE1(punycode, line__fold, foldlen);
+		src = fold;
+		if (timed)
+			lap(st.fold, &t);
 
-
+encode:
 		/* Encode the line. */
-		if ((outlen = punyenc(out, fold, outsz)) == (size_t)-1) {
+		if ((outlen = punyenc_case(out, src, NULL, outsz))
+		    == (size_t)-1) {
 			warnx("%s", "punyenc: irrecoverable encoding error");
+			st.errors++;
 			rval = 1;
+			/* Keep the answers in step with the requests. */
+			if (framed && putchar('\n') == EOF)
+				err(1, "putchar");
 			continue;
 		} else if (outlen >= outsz) {
 			/* output wasn't large enough, resize it. */
@@ -174,13 +402,775 @@ punyutil(void)
 				err(1, "realloc");
 			out = tmp;
 
-			(void)punyenc(out, fold, outsz);
+			(void)punyenc_case(out, src, NULL, outsz);
 		}
+		if (timed)
+			lap(st.enc, &t);
 		/* Use the '\0' terminator's storage to store a newline. */
 		out[outlen++] = '\n';
 
 		if (fwrite(out, 1, outlen, stdout) < outlen)
 			err(1, "fwrite");
+		DTRACE_PROBE1(punycode, line__write, outlen);
+	}
+	free(in);
+	free(fold);
+	free(out);
+	return rval;
+}
+
+/* compileutil: build a database of the hostnames on stdin for the -m option
+ * Every line is a hostname, which is case folded like in fieldutil(). The
+ * database is written to a temporary file which is then renamed to path, so
+ * processes that have the old database mapped keep reading it intact.
+ */
+static int
+compileutil(const char *path)
+{
+	ssize_t inlen;
+	char *in = NULL;
+	char *fold = NULL;
+	size_t insz = 0;
+	size_t foldsz = 0;
+	char **hosts = NULL;
+	size_t nhosts = 0;
+	size_t cap = 0;
+	char *tmppath;
+	size_t tmpsz;
+	mode_t mask;
+	size_t i;
+	int fd;
+	int rval = 0;
+	void *tmp;
+
+	for (;;) {
+		if ((inlen = getline(&in, &insz, stdin)) == -1) {
+			if (feof(stdin))
+				break;
+			err(1, "getline");
+		}
+		st.lines++;
+		st.bytes += inlen;
+		if (inlen > 0 && in[inlen-1] == '\n')
+			inlen--;
+		if (inlen == 0)
+			continue;
+
+		(void)foldfield(&fold, &foldsz, in, inlen);
+		if (punyenc_host(NULL, fold, 0) == (size_t)-1) {
+			warnx("invalid hostname: %s", fold);
+			st.errors++;
+			rval = 1;
+			continue;
+		}
+		if (nhosts == cap) {
+			cap = cap == 0 ? 1024 : cap * 2;
+			tmp = reallocarray(hosts, cap, sizeof(*hosts));
+			if (tmp == NULL)
+				err(1, "reallocarray");
+			hosts = tmp;
+		}
+		if ((hosts[nhosts++] = strdup(fold)) == NULL)
+			err(1, "strdup");
+	}
+
+	tmpsz = strlen(path) + sizeof(".XXXXXX");
+	if ((tmppath = malloc(tmpsz)) == NULL)
+		err(1, "malloc");
+	(void)snprintf(tmppath, tmpsz, "%s.XXXXXX", path);
+	if ((fd = mkstemp(tmppath)) == -1)
+		err(1, "%s", tmppath);
+	/* mkstemp() makes the file private, the database is meant to be shared. */
+	mask = umask(0);
+	(void)umask(mask);
+	if (fchmod(fd, 0666 & ~mask) == -1
+	    || punydb_build(fd, (const char *const *)hosts, nhosts) == -1
+	    || close(fd) == -1 || rename(tmppath, path) == -1) {
+		warn("%s", path);
+		(void)unlink(tmppath);
+		exit(1);
+	}
+
+	for (i = 0; i < nhosts; i++)
+		free(hosts[i]);
+	free(hosts);
+	free(tmppath);
+	free(fold);
+	free(in);
+	return rval;
+}
+
+/* framedutil: co-process mode, see the -F option
+ * Reads batches of lines that each end in a '\0' byte, in blocks with read(2).
+ * Every batch is encoded by fieldutil() or punyutil() as if it were the whole
+ * input, and its output is followed by a '\0' and written with a single
+ * fflush(), so the other process gets the whole response at once and the
+ * pipes are never written a byte at a time.
+ */
+static int
+framedutil(int field, int delim, int zone)
+{
+	enum {BLOCKSZ = 64 * 1024};
+	char *buf;
+	size_t bufsz = BLOCKSZ;
+	size_t len = 0;
+	size_t scanned = 0;
+	ssize_t r;
+	char *nul;
+	FILE *fp;
+	int eof = 0;
+	int rval = 0;
+	void *tmp;
+
+	if ((buf = malloc(bufsz)) == NULL)
+		err(1, "malloc");
+	while (!eof || len > 0) {
+		nul = memchr(buf + scanned, '\0', len - scanned);
+		if (nul == NULL && !eof) {
+			scanned = len;
+			if (len == bufsz) {
+				/* A batch doesn't fit, grow the buffer. */
+				if ((tmp = realloc(buf, bufsz * 2)) == NULL)
+					err(1, "realloc");
+				buf = tmp;
+				bufsz *= 2;
+			}
+			if ((r = read(STDIN_FILENO, buf + len, bufsz - len))
+			    == -1) {
+				if (errno == EINTR)
+					continue;
+				err(1, "read");
+			}
+			len += r;
+			eof = r == 0;
+			continue;
+		}
+		/* A batch cut short by the end of the input is still answered. */
+		if (nul == NULL)
+			nul = buf + len;
+
+		if (nul > buf) {
+			if ((fp = fmemopen(buf, nul - buf, "r")) == NULL)
+				err(1, "fmemopen");
+			if (field || zone)
+				rval |= fieldutil(fp, field, delim, zone);
+			else
+				rval |= punyutil(fp);
+			fclose(fp);
+			/* Like punyutil(), end every answer in a newline. */
+			if ((field || zone) && nul[-1] != '\n'
+			    && putchar('\n') == EOF)
+				err(1, "putchar");
+		}
+		if (putchar('\0') == EOF || fflush(stdout) == EOF)
+			err(1, "fflush");
+
+		if (nul < buf + len)
+			nul++;
+		len = buf + len - nul;
+		memmove(buf, nul, len);
+		scanned = 0;
+	}
+	free(buf);
+	return rval;
+}
+
+/* fieldutil: encode one field of every line as a hostname
+ * In zone mode, the field is the owner name of a zone file record or the name
+ * of an $ORIGIN directive, otherwise it's field number field of the fields
+ * separated by delim. Fields with non-ASCII characters are case folded and
+ * converted to ACE with punyenc_db(), the rest of the line is written as is.
+ * Reads the lines from fp.
+ */
+static int
+fieldutil(FILE *fp, int field, int delim, int zone)
+{
+	ssize_t inlen;
+	char *in = NULL;
+	char *fold = NULL;
+	char *out = NULL;
+	size_t insz = 0;
+	size_t foldsz = 0;
+	size_t outsz = 0;
+	const char *start;
+	const char *end;
+	const char *p;
+	size_t foldlen;
+	size_t outlen;
+	int rval = 0;
+	void *tmp;
+	struct timespec t;
+	int timed;
+
+	for (;;) {
+		if (wantreport)
+			report();
+		if (wantckpt)
+			checkpoint(fp);
+		if ((inlen = getline(&in, &insz, fp)) == -1) {
+			if (feof(fp))
+				break;
+			err(1, "getline");
+		}
+		DTRACE_PROBE1(punycode, line__read, inlen);
+		st.lines++;
+		st.bytes += inlen;
+
+		if (zone)
+			start = zonefield(in, in + inlen, &end);
+		else
+			start = nthfield(in, in + inlen, field, delim, &end);
+
+		/* Only fields with non-ASCII characters need encoding. */
+		for (p = start; p != NULL && p < end; p++) {
+			if (*p & 0x80)
+				break;
+		}
+		if (p == NULL || p == end) {
+			if (fwrite(in, 1, inlen, stdout) < (size_t)inlen)
+				err(1, "fwrite");
+			DTRACE_PROBE1(punycode, line__write, inlen);
+			continue;
+		}
+
+		if ((timed = st.encodings++ % SAMPLE == 0))
+			clock_gettime(CLOCK_MONOTONIC, &t);
+		foldlen = foldfield(&fold, &foldsz, start, end - start);
+		DTRACE_PROBE1(punycode, line__fold, foldlen);
+		if (timed)
+			lap(st.fold, &t);
+		if ((outlen = punyenc_db(db, out, fold, outsz)) == (size_t)-1) {
+			warnx("invalid hostname: %s", fold);
+			st.errors++;
+			rval = 1;
+			/* Don't lose the line. */
+			if (fwrite(in, 1, inlen, stdout) < (size_t)inlen)
+				err(1, "fwrite");
+			continue;
+		} else if (outlen >= outsz) {
+			outsz = outlen+1;
+			if ((tmp = realloc(out, outsz)) == NULL)
+				err(1, "realloc");
+			out = tmp;
+			(void)punyenc_db(db, out, fold, outsz);
+		}
+		if (timed)
+			lap(st.enc, &t);
+
+		/* Write the line around the field straight from the input. */
+		if (fwrite(in, 1, start - in, stdout) < (size_t)(start - in)
+		    || fwrite(out, 1, outlen, stdout) < outlen
+		    || fwrite(end, 1, in + inlen - end, stdout)
+		    < (size_t)(in + inlen - end))
+			err(1, "fwrite");
+		DTRACE_PROBE1(punycode, line__write,
+		    inlen - (end - start) + outlen);
+	}
+	free(in);
+	free(fold);
+	free(out);
+	return rval;
+}
+
+/* zonefield: find the name of a zone file line in [line, lineend)
+ * The name is the owner name of a record, or the name after an $ORIGIN
+ * directive. Puts the end of the name in *end.
+ *
+ * Returns the start of the name, or NULL if the line has none: the record has
+ * the previous record's owner, or the line is blank, a comment, or another
+ * directive.
+ */
+static const char *
+zonefield(const char *line, const char *lineend, const char **end)
+{
+	static const char origin[] = "$ORIGIN";
+	const char *p = line;
+
+	if (lineend - p >= (ptrdiff_t)sizeof(origin)
+	    && strncasecmp(p, origin, sizeof(origin)-1) == 0
+	    && (p[sizeof(origin)-1] == ' ' || p[sizeof(origin)-1] == '\t')) {
+		for (p += sizeof(origin)-1; p < lineend; p++) {
+			if (*p != ' ' && *p != '\t')
+				break;
+		}
+	}
+	if (p == lineend || *p == ' ' || *p == '\t' || *p == ';'
+	    || *p == '$' || *p == '\n')
+		return NULL;
+
+	*end = p + strcspn(p, " \t;\n");
+	if (*end > lineend)
+		*end = lineend;
+	return p;
+}
+
+/* nthfield: find field number field of the fields in [line, lineend)
+ * separated by delim. The newline isn't part of the last field. Puts the end of
+ * the field in *end.
+ *
+ * Returns the start of the field, or NULL if the line doesn't have that many
+ * fields.
+ */
+static const char *
+nthfield(const char *line, const char *lineend, int field, int delim,
+    const char **end)
+{
+	const char *p = line;
+
+	if (lineend > line && lineend[-1] == '\n')
+		lineend--;
+	/* memchr() is the fastest byte search the C library has. */
+	while (--field > 0) {
+		if ((p = memchr(p, delim, lineend - p)) == NULL)
+			return NULL;
+		p++;
+	}
+	if ((*end = memchr(p, delim, lineend - p)) == NULL)
+		*end = lineend;
+	return p;
+}
+
+/* foldfield: canonicalize and case fold the len bytes at field
+ * Puts the '\0' terminated result in *fold, which has size *foldsz and is grown
+ * as needed, see punyutil().
+ *
+ * Returns the length of the result.
+ */
+static size_t
+foldfield(char **fold, size_t *foldsz, const char *field, size_t len)
+{
+	size_t foldlen;
+	void *tmp;
+
+	foldlen = *foldsz;
+	tmp = u8_tolower((const uint8_t *)field, len, NULL, UNINORM_NFC,
+	    (uint8_t *)*fold, &foldlen);
+	if (tmp == NULL)
+		err(1, "u8_tolower");
+	if (tmp != *fold) {
+		free(*fold);
+		*fold = tmp;
+		*foldsz = foldlen;
+	}
+	if (foldlen == *foldsz) {
+		/* No room for the '\0' terminator. */
+		if ((tmp = realloc(*fold, foldlen+1)) == NULL)
+			err(1, "realloc");
+		*fold = tmp;
+		*foldsz = foldlen+1;
+	}
+	(*fold)[foldlen] = '\0';
+	return foldlen;
+}
+
+/* logutil: convert the hostnames in URLs and email addresses to ACE
+ * Reads stdin in large blocks. Runs of lines made of ASCII alone are written
+ * with a single fwrite() without looking at them any further, only lines with
+ * non-ASCII characters are searched for hostnames.
+ */
+static int
+logutil(void)
+{
+	enum {BLOCKSZ = 64 * 1024};
+	char *buf;
+	size_t bufsz = BLOCKSZ;
+	size_t len = 0;
+	ssize_t r;
+	const char *p;
+	const char *q;
+	const char *end;
+	const char *ls;
+	const char *le;
+	int eof = 0;
+	int rval = 0;
+	void *tmp;
+
+	if ((buf = malloc(bufsz)) == NULL)
+		err(1, "malloc");
+	while (!eof) {
+		if (wantreport)
+			report();
+		if (len == bufsz) {
+			/* A line doesn't fit, grow the buffer. */
+			if ((tmp = realloc(buf, bufsz * 2)) == NULL)
+				err(1, "realloc");
+			buf = tmp;
+			bufsz *= 2;
+		}
+		/*
+		 * read(2) instead of fread(3): don't wait for the block to fill
+		 * up before writing out the lines that arrived.
+		 */
+		if ((r = read(STDIN_FILENO, buf + len, bufsz - len)) == -1) {
+			if (errno == EINTR)
+				continue;
+			err(1, "read");
+		}
+		len += r;
+		eof = r == 0;
+
+		/* Only complete lines are processed, unless at the end. */
+		p = buf;
+		end = buf + len;
+		if (!eof) {
+			for (q = end; q > p && q[-1] != '\n'; q--)
+				;
+			end = q;
+		}
+
+		while (p < end) {
+			if ((q = nonascii(p, end)) == end) {
+				ls = le = end;
+			} else {
+				for (ls = q; ls > p && ls[-1] != '\n'; ls--)
+					;
+				if ((le = memchr(q, '\n', end - q)) == NULL)
+					le = end;
+				else
+					le++;
+			}
+			if (ls > p && fwrite(p, 1, ls - p, stdout)
+			    < (size_t)(ls - p))
+				err(1, "fwrite");
+			for (q = p; q < ls; q++)
+				st.lines += *q == '\n';
+			if (ls < le)
+				rval |= rewriteline(ls, le);
+			p = le;
+		}
+
+		st.bytes += end - buf;
+		len = buf + len - end;
+		memmove(buf, end, len);
+	}
+	free(buf);
+	if (fflush(stdout) == EOF)
+		err(1, "fflush");
+	return rval;
+}
+
+/* nonascii: find the first byte >= 0x80 in [p, end)
+ * Checks 32 bytes per iteration by ORing 4 words and testing the high bit of
+ * every byte at once.
+ *
+ * Returns end if there is none.
+ */
+static const char *
+nonascii(const char *p, const char *end)
+{
+	const uint_least64_t hi = 0x8080808080808080;
+	uint_least64_t w[4];
+
+	for (; end - p >= (ptrdiff_t)sizeof(w); p += sizeof(w)) {
+		memcpy(w, p, sizeof(w));
+		if (((w[0] | w[1] | w[2] | w[3]) & hi) != 0)
+			break;
+	}
+	for (; p < end; p++) {
+		if (*p & 0x80)
+			return p;
+	}
+	return end;
+}
+
+/* rewriteline: write the line [line, end) with the hostnames of URLs and
+ * email addresses converted to ACE
+ * A hostname follows "://" and an optional "user@", or it follows an '@'.
+ * Hostnames made of ASCII alone, and invalid ones, are written as is.
+ *
+ * Returns 1 if a hostname was invalid, 0 otherwise.
+ */
+static int
+rewriteline(const char *line, const char *end)
+{
+	static char *fold = NULL;
+	static char *out = NULL;
+	static size_t foldsz = 0;
+	static size_t outsz = 0;
+	const char *p;
+	const char *q;
+	const char *host;
+	const char *hend;
+	const char *copied;
+	size_t outlen;
+	int rval = 0;
+	void *tmp;
+	struct timespec t;
+	int timed;
+
+	st.lines++;
+	copied = line;
+	for (p = line; p < end; p = hend) {
+		host = NULL;
+		if (end - p > 3 && memcmp(p, "://", 3) == 0) {
+			/* Skip the userinfo. */
+			host = p + 3;
+			for (q = host; q < end && strchr("/?#@ \t\n", *q) == NULL;)
+				q++;
+			if (q < end && *q == '@')
+				host = q + 1;
+		} else if (*p == '@') {
+			host = p + 1;
+		}
+		if (host == NULL) {
+			hend = p + 1;
+			continue;
+		}
+		hend = hostend(host, end);
+		/* A '.' at the end is more likely a full stop. */
+		while (hend > host && hend[-1] == '.')
+			hend--;
+		if (hend == host)
+			continue;
+		if (nonascii(host, hend) == hend)
+			continue;
+
+		if ((timed = st.encodings++ % SAMPLE == 0))
+			clock_gettime(CLOCK_MONOTONIC, &t);
+		(void)foldfield(&fold, &foldsz, host, hend - host);
+		if (timed)
+			lap(st.fold, &t);
+		if ((outlen = punyenc_db(db, out, fold, outsz)) == (size_t)-1) {
+			warnx("invalid hostname: %s", fold);
+			st.errors++;
+			rval = 1;
+			continue;
+		} else if (outlen >= outsz) {
+			outsz = outlen+1;
+			if ((tmp = realloc(out, outsz)) == NULL)
+				err(1, "realloc");
+			out = tmp;
+			(void)punyenc_db(db, out, fold, outsz);
+		}
+		if (timed)
+			lap(st.enc, &t);
+		if (fwrite(copied, 1, host - copied, stdout)
+		    < (size_t)(host - copied)
+		    || fwrite(out, 1, outlen, stdout) < outlen)
+			err(1, "fwrite");
+		copied = hend;
+	}
+	if (fwrite(copied, 1, end - copied, stdout) < (size_t)(end - copied))
+		err(1, "fwrite");
+	return rval;
+}
+
+/* hostend: find the end of the hostname that starts at p and ends before end
+ * Hostnames are made of ASCII letters, digits, '-', '.' and non-ASCII letters,
+ * marks and digits. Anything else, such as ':', '/', '>' or a non-ASCII
+ * quotation mark, ends it.
+ */
+static const char *
+hostend(const char *p, const char *end)
+{
+	ucs4_t uc;
+	int n;
+
+	while (p < end) {
+		if (!(*p & 0x80)) {
+			if (!isalnum((unsigned char)*p) && *p != '-'
+			    && *p != '.')
+				break;
+			p++;
+			continue;
+		}
+		n = u8_mbtouc(&uc, (const uint8_t *)p, end - p);
+		if (!uc_is_general_category_withtable(uc, UC_CATEGORY_MASK_L
+		    | UC_CATEGORY_MASK_M | UC_CATEGORY_MASK_Nd))
+			break;
+		p += n;
+	}
+	return p;
+}
+
+/* ckptopen: resume from the checkpoint in path, if there is one
+ * conf is the hash of the options, which must be the same as the checkpoint's.
+ * The input is moved to the checkpoint's offset, and the output is cut back to
+ * its offset, dropping what was written after it. Then checkpoints are taken
+ * every CKPTSECS seconds.
+ */
+static void
+ckptopen(const char *path, uint_least64_t conf)
+{
+	struct sigaction sa;
+	struct stat in, out;
+	uintmax_t hash, errors;
+	intmax_t inoff, outoff;
+	size_t tmpsz;
+	FILE *fp;
+
+	if (fstat(STDIN_FILENO, &in) == -1 || fstat(STDOUT_FILENO, &out) == -1)
+		err(1, "fstat");
+	if (!S_ISREG(in.st_mode) || !S_ISREG(out.st_mode))
+		errx(1, "option -k: stdin and stdout must be files");
+	ckpt.path = path;
+	ckpt.conf = conf;
+	tmpsz = strlen(path) + sizeof(".XXXXXX");
+	if ((ckpt.tmppath = malloc(tmpsz)) == NULL)
+		err(1, "malloc");
+
+	if ((fp = fopen(path, "r")) == NULL) {
+		if (errno != ENOENT)
+			err(1, "%s", path);
+		/* A new conversion, append to whatever is in the output. */
+		if (fseeko(stdout, 0, SEEK_END) == -1)
+			err(1, "fseeko");
+	} else {
+		if (fscanf(fp, "%jx %jd %jd %ju", &hash, &inoff, &outoff,
+		    &errors) != 4 || inoff < 0 || outoff < 0)
+			errx(1, "%s: invalid checkpoint", path);
+		fclose(fp);
+		if (hash != conf)
+			errx(1, "%s: checkpoint of a run with other options",
+			    path);
+		if (out.st_size < outoff)
+			errx(1, "%s: the output is shorter than the checkpoint",
+			    path);
+		if (ftruncate(STDOUT_FILENO, outoff) == -1
+		    || fseeko(stdout, outoff, SEEK_SET) == -1
+		    || fseeko(stdin, inoff, SEEK_SET) == -1)
+			err(1, "%s", path);
+		st.errors = errors;
+	}
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = ckptreq;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	if (sigaction(SIGALRM, &sa, NULL) == -1)
+		err(1, "sigaction");
+	alarm(CKPTSECS);
+}
+
+/* checkpoint: record how far the conversion of fp got
+ * Called between lines. The output is flushed to the disk first so that the
+ * checkpoint is never ahead of it, and the checkpoint is written to a temporary
+ * file which is then renamed over the old one, so it's never half-written. A
+ * checkpoint that can't be written is skipped with a warning.
+ */
+static void
+checkpoint(FILE *fp)
+{
+	struct stat out;
+	off_t inoff;
+	FILE *ck;
+	int fd;
+
+	wantckpt = 0;
+	if (fflush(stdout) == EOF || fsync(STDOUT_FILENO) == -1
+	    || fstat(STDOUT_FILENO, &out) == -1)
+		err(1, "stdout");
+	if ((inoff = ftello(fp)) == -1)
+		err(1, "ftello");
+
+	(void)snprintf(ckpt.tmppath, strlen(ckpt.path) + sizeof(".XXXXXX"),
+	    "%s.XXXXXX", ckpt.path);
+	if ((fd = mkstemp(ckpt.tmppath)) == -1) {
+		warn("%s", ckpt.tmppath);
+		goto end;
+	}
+	if ((ck = fdopen(fd, "w")) == NULL) {
+		warn("%s", ckpt.tmppath);
+		close(fd);
+		goto fail;
+	}
+	if (fprintf(ck, "%016jx %jd %jd %ju\n", (uintmax_t)ckpt.conf,
+	    (intmax_t)inoff, (intmax_t)out.st_size, (uintmax_t)st.errors) < 0
+	    || fflush(ck) == EOF || fsync(fd) == -1) {
+		warn("%s", ckpt.tmppath);
+		fclose(ck);
+		goto fail;
+	}
+	if (fclose(ck) == EOF || rename(ckpt.tmppath, ckpt.path) == -1) {
+		warn("%s", ckpt.path);
+		goto fail;
+	}
+	goto end;
+fail:
+	(void)unlink(ckpt.tmppath);
+end:
+	alarm(CKPTSECS);
+}
+
+/* ckptreq: ask for a checkpoint() on SIGALRM */
+static void
+ckptreq(int sig)
+{
+	(void)sig;
+	wantckpt = 1;
+}
+
+/* inforeq: ask for a report() on SIGUSR1 or SIGINFO */
+static void
+inforeq(int sig)
+{
+	(void)sig;
+	wantreport = 1;
+}
+
+/* lap: count the time since *t in the histogram hist, and set *t to now */
+static void
+lap(uint_least64_t *hist, struct timespec *t)
+{
+	struct timespec now;
+	uint_least64_t ns;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	ns = (now.tv_sec - t->tv_sec) * 1000000000 + now.tv_nsec - t->tv_nsec;
+	for (i = 0; ns > 0 && i < LATBUCKETS-1; i++)
+		ns >>= 1;
+	hist[i]++;
+	*t = now;
+}
+
+/* since: the seconds from t0 to t1 */
+static double
+since(const struct timespec *t0, const struct timespec *t1)
+{
+	return (t1->tv_sec - t0->tv_sec) + (t1->tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/* report: print the statistics to stderr
+ * The current throughput is the one since the last report.
+ */
+static void
+report(void)
+{
+	struct timespec now;
+	double total;
+	double recent;
+	int i;
+
+	wantreport = 0;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	total = since(&st.start, &now);
+	recent = since(&st.last, &now);
+	fprintf(stderr, "%s: %ju lines, %ju bytes, %ju encodings, %ju errors"
+	    " in %.3f s\n", getprogname(), (uintmax_t)st.lines,
+	    (uintmax_t)st.bytes, (uintmax_t)st.encodings, (uintmax_t)st.errors,
+	    total);
+	fprintf(stderr, "%s: %.2f MB/s now, %.2f MB/s on average\n",
+	    getprogname(),
+	    recent > 0 ? (st.bytes - st.lastbytes) / recent / 1e6 : 0.0,
+	    total > 0 ? st.bytes / total / 1e6 : 0.0);
+	fprintf(stderr, "%s: latency of 1 in %d encodings:\n", getprogname(),
+	    SAMPLE);
+	fprintf(stderr, "%22s %12s %12s\n", "ns", "u8_tolower", "punyenc");
+	for (i = 0; i < LATBUCKETS; i++) {
+		if (st.fold[i] == 0 && st.enc[i] == 0)
+			continue;
+		if (i == 0)
+			fprintf(stderr, "%22d", 0);
+		else if (i == LATBUCKETS-1)
+			fprintf(stderr, "%10s   %9ju", ">=",
+			    (uintmax_t)1 << (i-1));
+		else
+			fprintf(stderr, "%10ju - %9ju", (uintmax_t)1 << (i-1),
+			    ((uintmax_t)1 << i) - 1);
+		fprintf(stderr, " %12ju %12ju\n", (uintmax_t)st.fold[i],
+		    (uintmax_t)st.enc[i]);
 	}
-	/* NOTREACHED */
+	st.last = now;
+	st.lastbytes = st.bytes;
 }
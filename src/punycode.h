@@ -18,6 +18,7 @@
 #define H_PUNYCODE
 
 #include <stddef.h>
+#include <stdint.h>
 
 #if defined(__cplusplus)
 #define PUNYCODE_RESTRICT
@@ -28,6 +29,154 @@ extern "C" {
 
 size_t punyenc(char [PUNYCODE_RESTRICT],
     const char [PUNYCODE_RESTRICT static 1], size_t);
+size_t punyenc_cap(char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t, size_t);
+size_t punydec(char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+
+size_t punyenc_u16(char [PUNYCODE_RESTRICT],
+    const uint_least16_t [PUNYCODE_RESTRICT static 1], size_t);
+size_t punyenc_u32(char [PUNYCODE_RESTRICT],
+    const uint_least32_t [PUNYCODE_RESTRICT static 1], size_t);
+size_t punydec_u16(uint_least16_t [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+size_t punydec_u32(uint_least32_t [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+
+/* Row statuses of the batch functions. */
+enum {
+	PUNYBATCH_OK,
+	PUNYBATCH_ERROR,
+};
+
+size_t punyenc_batch(const char *PUNYCODE_RESTRICT,
+    const uint32_t *PUNYCODE_RESTRICT, size_t, char *PUNYCODE_RESTRICT, size_t,
+    uint32_t *PUNYCODE_RESTRICT, unsigned char *PUNYCODE_RESTRICT);
+size_t punydec_batch(const char *PUNYCODE_RESTRICT,
+    const uint32_t *PUNYCODE_RESTRICT, size_t, char *PUNYCODE_RESTRICT, size_t,
+    uint32_t *PUNYCODE_RESTRICT, unsigned char *PUNYCODE_RESTRICT);
+size_t punyenc_batch_lanes(const char *PUNYCODE_RESTRICT,
+    const uint32_t *PUNYCODE_RESTRICT, size_t, char *PUNYCODE_RESTRICT, size_t,
+    uint32_t *PUNYCODE_RESTRICT, unsigned char *PUNYCODE_RESTRICT);
+
+const char *punyisa(void);
+
+struct punypool;
+
+struct punypool *punypool_new(int);
+void punypool_free(struct punypool *);
+size_t punyenc_batch_pool(struct punypool *, const char *PUNYCODE_RESTRICT,
+    const uint32_t *PUNYCODE_RESTRICT, size_t, char *PUNYCODE_RESTRICT, size_t,
+    uint32_t *PUNYCODE_RESTRICT, unsigned char *PUNYCODE_RESTRICT);
+size_t punydec_batch_pool(struct punypool *, const char *PUNYCODE_RESTRICT,
+    const uint32_t *PUNYCODE_RESTRICT, size_t, char *PUNYCODE_RESTRICT, size_t,
+    uint32_t *PUNYCODE_RESTRICT, unsigned char *PUNYCODE_RESTRICT);
+
+enum {PUNYSTATS_BUCKETS = 12};
+
+/*
+ * Encoder statistics. Bucket 0 of the histograms counts labels where the value
+ * is 0, bucket i counts values from 2^(i-1) to 2^i - 1, and the last bucket
+ * counts everything past that.
+ */
+struct punystats {
+	uint_least64_t labels;		/* Labels encoded. */
+	uint_least64_t ascii;		/* Labels made of basic codepoints. */
+	uint_least64_t overflows;	/* Labels that returned (size_t)-1. */
+	uint_least64_t toolong;		/* Labels that returned (size_t)-2. */
+	uint_least64_t inbytes;		/* Bytes of input. */
+	uint_least64_t outbytes;	/* Bytes of punycode. */
+	/* Histogram of the amount of codepoints in labels. */
+	uint_least64_t inlen[PUNYSTATS_BUCKETS];
+	/* Histogram of the amount of distinct non-basic codepoints in labels. */
+	uint_least64_t distinct[PUNYSTATS_BUCKETS];
+};
+
+int punystats_get(struct punystats *);
+void punystats_reset(void);
+
+/* Phases of the encoder, see punyprof_get(3). */
+enum {
+	PUNYPROF_DECODE,	/* Reading the input and copying basic code points. */
+	PUNYPROF_MINSCAN,	/* Looking for the next code point to insert. */
+	PUNYPROF_DELTA,		/* Encoding the deltas. */
+	PUNYPROF_ADAPT,		/* Adapting the bias. */
+	PUNYPROF_PHASES
+};
+enum {PUNYPROF_HW, PUNYPROF_CLOCK};
+
+struct punyprof {
+	uint_least64_t calls;		/* Times the phase was entered. */
+	uint_least64_t cycles;		/* Or nanoseconds, see punyprof_get(3). */
+	uint_least64_t instructions;
+	uint_least64_t branchmisses;
+	uint_least64_t l1dmisses;
+};
+
+int punyprof_get(struct punyprof [static PUNYPROF_PHASES]);
+void punyprof_reset(void);
+
+size_t punyenc_wire(unsigned char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+size_t punyenc_host(char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+
+/* Why punyenc_idna() rejects a hostname. */
+enum {
+	PUNYIDNA_OK,
+	PUNYIDNA_SYNTAX,	/* Not a valid hostname. */
+	PUNYIDNA_DISALLOWED,	/* A code point is DISALLOWED or UNASSIGNED. */
+	PUNYIDNA_CONTEXTJ,	/* A joiner is out of its context. */
+	PUNYIDNA_CONTEXTO,	/* Another code point is out of its context. */
+	PUNYIDNA_HYPHEN,	/* '-' at either end, or 3rd and 4th. */
+	PUNYIDNA_COMBINING,	/* A label starts with a combining mark. */
+	PUNYIDNA_BIDI,		/* The Bidi rule fails. */
+};
+
+size_t punyenc_idna(char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t, int *);
+int punyidna_label(const char [static 1]);
+
+size_t punyenc_spans(const char [static 1],
+    int (*)(void *, const char *, size_t), void *);
+int punycmp(const char [static 1], const char [static 1]);
+uint_least64_t punyhash(const char [static 1], uint_least64_t);
+uint_least64_t punyhash_ace(const char [static 1], uint_least64_t);
+size_t punydec_wire(char [PUNYCODE_RESTRICT],
+    const unsigned char *PUNYCODE_RESTRICT, size_t, size_t);
+size_t punydec_host(char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+size_t punyenc_case(char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1],
+    const unsigned char *PUNYCODE_RESTRICT, size_t);
+size_t punydec_case(char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], unsigned char *PUNYCODE_RESTRICT,
+    size_t);
+
+struct punydb;
+
+const struct punydb *punydb_open(const char *);
+void punydb_close(const struct punydb *);
+int punydb_build(int, const char *const [], size_t);
+const char *punydb_enc(const struct punydb *, const char [static 1]);
+const char *punydb_dec(const struct punydb *, const char [static 1]);
+size_t punyenc_db(const struct punydb *, char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+
+/* Where punycoded(8) listens unless told otherwise. */
+#define PUNYD_SOCKET "/var/run/punycoded.sock"
+
+/* Builds of the library without punycoded(8) define PUNYCODE_NO_PUNYD. */
+#if !defined(PUNYCODE_NO_PUNYD)
+struct punyd;
+
+struct punyd *punyd_open(const char *);
+void punyd_close(struct punyd *);
+size_t punyd_enc(struct punyd *, char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+size_t punyd_dec(struct punyd *, char [PUNYCODE_RESTRICT],
+    const char [PUNYCODE_RESTRICT static 1], size_t);
+#endif
 
 #if defined(__cplusplus)
 }
@@ -0,0 +1,753 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * punycoded: hostname conversion daemon
+ *
+ * The protocol is described in punyd.c. Clients may pipeline requests, the
+ * answers come back in the order of the requests.
+ *
+ * The main thread runs an epoll(7) loop. Every time around the loop, it reads
+ * what every ready client sent and gathers the complete requests of all of
+ * them into one batch. Requests in the cache are answered from it, the rest
+ * are split among the threads like punypool.c splits a batch, and their
+ * answers go into the cache. Then the answers are queued on their clients in
+ * request order and written without blocking. Only the main thread touches
+ * the cache and the clients, the other threads only see the batch.
+ */
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <punycode.h>
+
+enum {
+	/* The longest request, newline included. */
+	linemax = 4096,
+	/*
+	 * The longest answer. A valid hostname encodes to 254 octets at most
+	 * and decodes to 4 octets per octet of ACE at most.
+	 */
+	ansmax = 1024,
+	/* Stop reading from a client with this much output it didn't read. */
+	outmax = 64 * 1024,
+	maxevents = 64,
+	/* Requests per chunk claimed by a thread. */
+	chunkreqs = 64,
+	/* Fewer cache misses than this aren't worth waking the threads. */
+	poolmin = 256,
+};
+
+struct conn {
+	int fd;
+	int events;		/* What epoll watches for. */
+	int eof;
+	int queued;		/* On the list of clients with input. */
+	char *in;
+	size_t parsed;		/* Bytes of in that were parsed. */
+	size_t inlen;
+	size_t insize;
+	char *out;
+	size_t outoff;		/* Bytes of out already written. */
+	size_t outlen;
+	size_t outsize;
+};
+
+struct req {
+	struct conn *conn;
+	int op;
+	const char *name;	/* '\0' terminated in conn->in. */
+	uint_least64_t hash;
+	const char *ans;	/* NULL if the name is invalid. */
+	size_t anslen;
+	int miss;
+	char buf[ansmax];	/* The answer of a miss. */
+};
+
+/* A direct-mapped cache of answers. */
+struct centry {
+	uint_least64_t hash;
+	int op;
+	char *name;		/* NULL if the entry is empty. */
+	char *ans;		/* NULL if the name is invalid. */
+	size_t anslen;
+};
+
+struct pool {
+	pthread_mutex_t mtx;
+	pthread_cond_t work;
+	pthread_cond_t done;
+	int nthreads;		/* Including the main thread. */
+	unsigned long gen;
+	int busy;
+	struct req **miss;
+	size_t nmiss;
+	size_t next;
+};
+
+static struct centry *cache;
+static size_t cachemask;
+static struct pool pool;
+static volatile sig_atomic_t quit;
+static sigset_t waitmask;	/* The signal mask while waiting for events. */
+
+static void serve(int, int);
+static int accepter(int, int);
+static void readconn(struct conn *);
+static int parse(struct conn *, struct req **, size_t *, size_t *);
+static void lookup(struct req *);
+static void store(struct req *);
+static void answer(struct req *);
+static void *worker(void *);
+static void work(void);
+static void convert(struct req *);
+static void flushconn(struct conn *);
+static void setevents(int, struct conn *);
+static void closeconn(int, struct conn *);
+static int append(char **, size_t *, size_t *, const char *, size_t);
+static int listener(const char *);
+static void stop(int);
+
+int
+main(int argc, char *argv[])
+{
+	int c;
+	int fg = 0;
+	const char *path = PUNYD_SOCKET;
+	const char *errstr;
+	long long entries = 65536;
+	int nthreads = 0;
+	long ncpu;
+	pthread_t tid;
+	struct sigaction sa;
+	sigset_t set;
+	size_t size;
+	int lfd;
+	int ep;
+	int i;
+
+	while ((c = getopt(argc, argv, "c:dj:s:")) != -1) {
+		switch (c) {
+		case 'c':
+			entries = strtonum(optarg, 1, 1LL << 30, &errstr);
+			if (errstr != NULL)
+				errx(1, "option -c: cache size is %s", errstr);
+			break;
+		case 'd':
+			fg = 1;
+			break;
+		case 'j':
+			nthreads = strtonum(optarg, 1, 1024, &errstr);
+			if (errstr != NULL)
+				errx(1, "option -j: thread count is %s",
+				    errstr);
+			break;
+		case 's':
+			path = optarg;
+			break;
+		default:
+			exit(1);
+		}
+	}
+	if (argv[optind] != NULL)
+		errx(1, "extraneous non-option argument: '%s'", argv[optind]);
+
+	/* The cache's size is a power of 2 so the hash can be masked. */
+	for (size = 1; size < (size_t)entries; size *= 2)
+		;
+	if ((cache = calloc(size, sizeof(*cache))) == NULL)
+		err(1, "calloc");
+	cachemask = size - 1;
+
+	if (nthreads == 0) {
+		ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+		nthreads = ncpu > 0 && ncpu < 1024 ? ncpu : 1;
+	}
+	pthread_mutex_init(&pool.mtx, NULL);
+	pthread_cond_init(&pool.work, NULL);
+	pthread_cond_init(&pool.done, NULL);
+	pool.nthreads = nthreads;
+
+	memset(&sa, 0, sizeof(sa));
+	sigemptyset(&sa.sa_mask);
+	sa.sa_handler = SIG_IGN;
+	if (sigaction(SIGPIPE, &sa, NULL) == -1)
+		err(1, "sigaction");
+	/*
+	 * SIGTERM and SIGINT are only let in while waiting for events, so
+	 * quit can't be set between its test and the wait.
+	 */
+	sa.sa_handler = stop;
+	if (sigaction(SIGTERM, &sa, NULL) == -1
+	    || sigaction(SIGINT, &sa, NULL) == -1)
+		err(1, "sigaction");
+	sigemptyset(&set);
+	sigaddset(&set, SIGTERM);
+	sigaddset(&set, SIGINT);
+	if (sigprocmask(SIG_BLOCK, &set, &waitmask) == -1)
+		err(1, "sigprocmask");
+
+	lfd = listener(path);
+	if ((ep = epoll_create1(EPOLL_CLOEXEC)) == -1)
+		err(1, "epoll_create1");
+	/* Stay in the directory of a relative path, to remove it at exit. */
+	if (!fg && daemon(path[0] != '/', 0) == -1)
+		err(1, "daemon");
+
+	/* Start the threads after daemon(), fork() only keeps the caller. */
+	for (i = 1; i < nthreads; i++) {
+		if ((errno = pthread_create(&tid, NULL, worker, NULL)) != 0)
+			err(1, "pthread_create");
+	}
+
+	serve(lfd, ep);
+	unlink(path);
+	return 0;
+}
+
+/* serve: answer requests until SIGTERM or SIGINT */
+static void
+serve(int lfd, int ep)
+{
+	struct epoll_event ev;
+	struct epoll_event evs[maxevents];
+	struct conn **ready = NULL;
+	size_t nready = 0;
+	size_t readysize = 0;
+	struct req *reqs = NULL;
+	struct req **miss = NULL;
+	size_t nreq;
+	size_t reqsize = 0;
+	size_t nmiss;
+	struct conn *conn;
+	void *tmp;
+	size_t i;
+	int n;
+	int r;
+	int full = 0;	/* Out of descriptors, the listener isn't watched. */
+	int closed;
+
+	ev.events = EPOLLIN;
+	ev.data.ptr = NULL;
+	if (epoll_ctl(ep, EPOLL_CTL_ADD, lfd, &ev) == -1)
+		err(1, "epoll_ctl");
+
+	while (!quit) {
+		/* Without clients to close, try accepting again in a second. */
+		n = epoll_pwait(ep, evs, maxevents, full ? 1000 : -1,
+		    &waitmask);
+		if (n == -1) {
+			if (errno == EINTR)
+				continue;
+			err(1, "epoll_pwait");
+		}
+		closed = 0;
+
+		/* Read from every client that's ready. */
+		nready = 0;
+		for (i = 0; i < (size_t)n; i++) {
+			if ((conn = evs[i].data.ptr) == NULL) {
+				while ((r = accepter(lfd, ep)) == 0)
+					;
+				/*
+				 * The listener stays readable while the client
+				 * waits, stop watching it or epoll_pwait()
+				 * spins.
+				 */
+				if (r == -2) {
+					ev.events = 0;
+					if (epoll_ctl(ep, EPOLL_CTL_MOD, lfd,
+					    &ev) == -1)
+						err(1, "epoll_ctl");
+					full = 1;
+				}
+				continue;
+			}
+			if (evs[i].events & EPOLLOUT)
+				flushconn(conn);
+			if (evs[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+				readconn(conn);
+			if (conn->queued)
+				continue;
+			if (nready == readysize) {
+				readysize = readysize ? readysize * 2 : 64;
+				tmp = reallocarray(ready, readysize,
+				    sizeof(*ready));
+				if (tmp == NULL)
+					err(1, "reallocarray");
+				ready = tmp;
+			}
+			conn->queued = 1;
+			ready[nready++] = conn;
+		}
+
+		/* Batch their requests, answer what's in the cache. */
+		nreq = 0;
+		for (i = 0; i < nready; i++) {
+			if (parse(ready[i], &reqs, &nreq, &reqsize) == -1) {
+				ready[i]->eof = 1;
+				ready[i]->parsed = ready[i]->inlen;
+			}
+		}
+		if ((tmp = reallocarray(miss, reqsize, sizeof(*miss))) == NULL
+		    && reqsize > 0)
+			err(1, "reallocarray");
+		miss = tmp;
+		nmiss = 0;
+		for (i = 0; i < nreq; i++) {
+			lookup(&reqs[i]);
+			if (reqs[i].miss)
+				miss[nmiss++] = &reqs[i];
+		}
+
+		/* Convert the rest. */
+		pool.miss = miss;
+		pool.nmiss = nmiss;
+		pool.next = 0;
+		if (nmiss >= poolmin && pool.nthreads > 1) {
+			pthread_mutex_lock(&pool.mtx);
+			pool.busy = pool.nthreads - 1;
+			pool.gen++;
+			pthread_cond_broadcast(&pool.work);
+			pthread_mutex_unlock(&pool.mtx);
+			work();
+			pthread_mutex_lock(&pool.mtx);
+			while (pool.busy > 0)
+				pthread_cond_wait(&pool.done, &pool.mtx);
+			pthread_mutex_unlock(&pool.mtx);
+		} else {
+			work();
+		}
+
+		/* The hits point into the cache, answer before storing. */
+		for (i = 0; i < nreq; i++)
+			answer(&reqs[i]);
+		for (i = 0; i < nmiss; i++)
+			store(miss[i]);
+
+		/*
+		 * The requests pointed into the input buffers, only now can
+		 * the rest of the input move to the front.
+		 */
+		for (i = 0; i < nready; i++) {
+			conn = ready[i];
+			conn->queued = 0;
+			if (conn->parsed > 0) {
+				conn->inlen -= conn->parsed;
+				memmove(conn->in, conn->in + conn->parsed,
+				    conn->inlen);
+				conn->parsed = 0;
+			}
+			/* Drop a client whose line is too long. */
+			if (conn->inlen >= linemax)
+				conn->eof = 1;
+			flushconn(conn);
+			if (conn->eof && conn->outlen == conn->outoff) {
+				closeconn(ep, conn);
+				closed = 1;
+			} else
+				setevents(ep, conn);
+		}
+
+		if (full && (closed || n == 0)) {
+			ev.events = EPOLLIN;
+			if (epoll_ctl(ep, EPOLL_CTL_MOD, lfd, &ev) == -1)
+				err(1, "epoll_ctl");
+			full = 0;
+		}
+	}
+	free(miss);
+	free(reqs);
+	free(ready);
+}
+
+/* accepter: accept a client
+ * Returns -1 when there are no more clients waiting, or -2 when there are but
+ * they can't be accepted until a descriptor is closed.
+ */
+static int
+accepter(int lfd, int ep)
+{
+	struct conn *conn;
+	int fd;
+	int e;
+
+	if ((fd = accept4(lfd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC))
+	    == -1) {
+		e = errno;
+		if (e != EAGAIN && e != EWOULDBLOCK && e != ECONNABORTED
+		    && e != EINTR)
+			warn("accept4");
+		if (e == EMFILE || e == ENFILE)
+			return -2;
+		return e == ECONNABORTED || e == EINTR ? 0 : -1;
+	}
+	if ((conn = calloc(1, sizeof(*conn))) == NULL) {
+		warn("calloc");
+		close(fd);
+		return 0;
+	}
+	conn->fd = fd;
+	setevents(ep, conn);
+	if (conn->events == 0) {
+		close(fd);
+		free(conn);
+	}
+	return 0;
+}
+
+/* readconn: read what a client sent, unless it has too much output queued */
+static void
+readconn(struct conn *conn)
+{
+	ssize_t r;
+	void *tmp;
+
+	while (!conn->eof && conn->outlen - conn->outoff < outmax) {
+		if (conn->insize - conn->inlen < linemax) {
+			tmp = realloc(conn->in, conn->insize + linemax);
+			if (tmp == NULL) {
+				warn("realloc");
+				conn->eof = 1;
+				break;
+			}
+			conn->in = tmp;
+			conn->insize += linemax;
+		}
+		r = read(conn->fd, conn->in + conn->inlen,
+		    conn->insize - conn->inlen);
+		if (r == -1 && errno == EINTR)
+			continue;
+		if (r == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			break;
+		if (r <= 0) {
+			conn->eof = 1;
+			break;
+		}
+		conn->inlen += r;
+		/* Let the other clients in once a few lines are here. */
+		if (conn->inlen >= 16 * linemax)
+			break;
+	}
+}
+
+/* parse: add the complete requests in a client's input to the batch
+ * Each request's newline is replaced with a '\0'.
+ *
+ * Returns -1 if the client must be dropped.
+ */
+static int
+parse(struct conn *conn, struct req **reqs, size_t *nreq, size_t *reqsize)
+{
+	struct req *r;
+	char *p, *end, *nl;
+	void *tmp;
+
+	p = conn->in + conn->parsed;
+	end = conn->in + conn->inlen;
+	while ((nl = memchr(p, '\n', end - p)) != NULL) {
+		if (*nreq == *reqsize) {
+			*reqsize = *reqsize ? *reqsize * 2 : 256;
+			tmp = reallocarray(*reqs, *reqsize, sizeof(**reqs));
+			if (tmp == NULL)
+				err(1, "reallocarray");
+			*reqs = tmp;
+		}
+		*nl = '\0';
+		if (nl - p >= linemax || (*p != 'e' && *p != 'd'))
+			return -1;
+		r = &(*reqs)[(*nreq)++];
+		r->conn = conn;
+		r->op = *p;
+		r->name = p + 1;
+		p = nl + 1;
+		conn->parsed = p - conn->in;
+	}
+	return 0;
+}
+
+/* lookup: answer a request from the cache, or mark it as a miss
+ * The key is a hash of the request's bytes, punyhash() would encode the name
+ * to hash it and cost as much as the conversion a hit saves.
+ */
+static void
+lookup(struct req *r)
+{
+	struct centry *e;
+
+	r->hash = punyhash_ace(r->name, r->op);
+	e = &cache[r->hash & cachemask];
+	r->miss = e->name == NULL || e->hash != r->hash || e->op != r->op
+	    || strcmp(e->name, r->name) != 0;
+	if (!r->miss) {
+		r->ans = e->ans;
+		r->anslen = e->anslen;
+	}
+}
+
+/* store: put the answer of a miss in the cache, replacing what was there */
+static void
+store(struct req *r)
+{
+	struct centry *e;
+	char *name, *ans = NULL;
+
+	e = &cache[r->hash & cachemask];
+	if (e->name != NULL && e->hash == r->hash && e->op == r->op
+	    && strcmp(e->name, r->name) == 0)
+		return;	/* An earlier miss in the batch stored it. */
+	if ((name = strdup(r->name)) == NULL
+	    || (r->ans != NULL && (ans = strdup(r->ans)) == NULL)) {
+		free(name);
+		return;
+	}
+	free(e->name);
+	free(e->ans);
+	e->hash = r->hash;
+	e->op = r->op;
+	e->name = name;
+	e->ans = ans;
+	e->anslen = r->anslen;
+}
+
+/* answer: queue the answer to a request on its client */
+static void
+answer(struct req *r)
+{
+	struct conn *conn = r->conn;
+	int ok;
+
+	if (r->ans != NULL) {
+		ok = append(&conn->out, &conn->outlen, &conn->outsize, "+", 1)
+		    == 0 && append(&conn->out, &conn->outlen, &conn->outsize,
+		    r->ans, r->anslen) == 0;
+	} else {
+		ok = append(&conn->out, &conn->outlen, &conn->outsize, "-", 1)
+		    == 0;
+	}
+	if (!ok || append(&conn->out, &conn->outlen, &conn->outsize, "\n", 1)
+	    == -1) {
+		warn("realloc");
+		conn->eof = 1;
+	}
+}
+
+static void *
+worker(void *arg)
+{
+	unsigned long seen = 0;
+
+	(void)arg;
+	pthread_mutex_lock(&pool.mtx);
+	for (;;) {
+		while (pool.gen == seen)
+			pthread_cond_wait(&pool.work, &pool.mtx);
+		seen = pool.gen;
+		pthread_mutex_unlock(&pool.mtx);
+
+		work();
+
+		pthread_mutex_lock(&pool.mtx);
+		if (--pool.busy == 0)
+			pthread_cond_signal(&pool.done);
+	}
+	return NULL;
+}
+
+/* work: claim and convert chunks of the misses until there are none left */
+static void
+work(void)
+{
+	size_t c;
+	size_t i;
+	size_t end;
+
+	for (;;) {
+		pthread_mutex_lock(&pool.mtx);
+		c = pool.next;
+		pool.next += chunkreqs;
+		pthread_mutex_unlock(&pool.mtx);
+		if (c >= pool.nmiss)
+			return;
+		end = pool.nmiss - c < chunkreqs ? pool.nmiss : c + chunkreqs;
+		for (i = c; i < end; i++)
+			convert(pool.miss[i]);
+	}
+}
+
+/* convert: answer a request that wasn't in the cache */
+static void
+convert(struct req *r)
+{
+	size_t len;
+
+	if (r->op == 'e')
+		len = punyenc_host(r->buf, r->name, sizeof(r->buf));
+	else
+		len = punydec_host(r->buf, r->name, sizeof(r->buf));
+	r->ans = len < sizeof(r->buf) ? r->buf : NULL;
+	r->anslen = len;
+}
+
+/* flushconn: write a client's output until the socket is full */
+static void
+flushconn(struct conn *conn)
+{
+	ssize_t w;
+
+	while (conn->outoff < conn->outlen) {
+		w = write(conn->fd, conn->out + conn->outoff,
+		    conn->outlen - conn->outoff);
+		if (w == -1 && errno == EINTR)
+			continue;
+		if (w == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			break;
+		if (w == -1) {
+			/* The client is gone, don't wait for its input. */
+			conn->eof = 1;
+			conn->outoff = conn->outlen;
+			break;
+		}
+		conn->outoff += w;
+	}
+	if (conn->outoff == conn->outlen)
+		conn->outoff = conn->outlen = 0;
+}
+
+/* setevents: tell epoll what a client is waiting for
+ * A client is only read from while its output is short, and only written to
+ * while there's output.
+ */
+static void
+setevents(int ep, struct conn *conn)
+{
+	struct epoll_event ev;
+	int op;
+
+	ev.events = 0;
+	if (!conn->eof && conn->outlen - conn->outoff < outmax)
+		ev.events |= EPOLLIN;
+	if (conn->outoff < conn->outlen)
+		ev.events |= EPOLLOUT;
+	if ((int)ev.events == conn->events)
+		return;
+	ev.data.ptr = conn;
+	op = conn->events == 0 ? EPOLL_CTL_ADD : ev.events == 0
+	    ? EPOLL_CTL_DEL : EPOLL_CTL_MOD;
+	if (epoll_ctl(ep, op, conn->fd, &ev) == -1) {
+		warn("epoll_ctl");
+		return;
+	}
+	conn->events = ev.events;
+}
+
+static void
+closeconn(int ep, struct conn *conn)
+{
+	if (conn->events != 0)
+		epoll_ctl(ep, EPOLL_CTL_DEL, conn->fd, NULL);
+	close(conn->fd);
+	free(conn->in);
+	free(conn->out);
+	free(conn);
+}
+
+/* append: append len bytes of src to the buffer *buf */
+static int
+append(char **buf, size_t *buflen, size_t *bufsize, const char *src,
+    size_t len)
+{
+	size_t size;
+	void *tmp;
+
+	if (*bufsize - *buflen < len) {
+		size = *bufsize ? *bufsize : 256;
+		while (size - *buflen < len)
+			size *= 2;
+		if ((tmp = realloc(*buf, size)) == NULL)
+			return -1;
+		*buf = tmp;
+		*bufsize = size;
+	}
+	memcpy(*buf + *buflen, src, len);
+	*buflen += len;
+	return 0;
+}
+
+/* listener: listen on the socket at path
+ * A socket file that nothing listens on is left over from a daemon that
+ * didn't exit cleanly, and is replaced. Anything else at path is an error.
+ */
+static int
+listener(const char *path)
+{
+	struct sockaddr_un addr;
+	struct stat sb;
+	int fd;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path))
+		errx(1, "%s: %s", path, strerror(ENAMETOOLONG));
+	strcpy(addr.sun_path, path);
+
+	if ((fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) == -1)
+		err(1, "socket");
+	if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+		errx(1, "%s: already in use", path);
+	close(fd);
+	if (lstat(path, &sb) == 0) {
+		if (!S_ISSOCK(sb.st_mode))
+			errx(1, "%s: %s", path, strerror(EADDRINUSE));
+		if (unlink(path) == -1 && errno != ENOENT)
+			err(1, "%s", path);
+	} else if (errno != ENOENT)
+		err(1, "%s", path);
+
+	if ((fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) == -1)
+		err(1, "socket");
+	if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+		err(1, "%s", path);
+	/* Any local user may convert hostnames. */
+	if (chmod(path, 0666) == -1)
+		err(1, "%s", path);
+	if (listen(fd, SOMAXCONN) == -1)
+		err(1, "listen");
+	if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == -1)
+		err(1, "fcntl");
+	return fd;
+}
+
+static void
+stop(int sig)
+{
+	(void)sig;
+	quit = 1;
+}
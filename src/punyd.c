@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Client of punycoded(8).
+ *
+ * Requests and answers are lines on an AF_UNIX stream socket. A request is 'e'
+ * followed by a hostname to encode with punyenc_host(), or 'd' followed by one
+ * to decode with punydec_host(). The answer is '+' followed by the result, or
+ * '-' if the hostname is invalid. Answers come in the order of the requests,
+ * so a client can send many requests before it reads their answers, but this
+ * one sends one at a time.
+ *
+ * If the daemon isn't running, or stops answering, the client does the work
+ * itself and tries to connect again a second later, so a program that uses it
+ * works the same with or without the daemon.
+ *
+ * Unlike libpunycode.c, this file needs POSIX sockets.
+ */
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "punycode.h"
+
+#if !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0
+#endif
+
+enum {
+	/* The longest request or answer, newline included. */
+	linemax = 4096,
+	/* How long to wait for the daemon before doing the work ourselves. */
+	timeout_ms = 1000,
+};
+
+struct punyd {
+	struct sockaddr_un addr;
+	int fd;			/* -1 if not connected. */
+	time_t retry;		/* When to try to connect again. */
+	size_t len;		/* Bytes in buf. */
+	char buf[linemax];
+};
+
+static void dconnect(struct punyd *);
+static void ddisconnect(struct punyd *);
+static size_t request(struct punyd *, int, const char *, char *, size_t);
+
+/* punyd_open: get a client of punycoded(8)
+ * Connects to the daemon listening on the socket at path, or at the default
+ * path if path is NULL. It isn't an error if the daemon isn't running, the
+ * client then does the work itself.
+ *
+ * Returns NULL and sets errno if it runs out of memory or path is too long.
+ */
+struct punyd *
+punyd_open(const char *path)
+{
+	struct punyd *d;
+
+	if (path == NULL && (path = getenv("PUNYCODED_SOCKET")) == NULL)
+		path = PUNYD_SOCKET;
+	if (strlen(path) >= sizeof(d->addr.sun_path)) {
+		errno = ENAMETOOLONG;
+		return NULL;
+	}
+	if ((d = calloc(1, sizeof(*d))) == NULL)
+		return NULL;
+	d->addr.sun_family = AF_UNIX;
+	strcpy(d->addr.sun_path, path);
+	d->fd = -1;
+	dconnect(d);
+	return d;
+}
+
+/* punyd_close: disconnect and free a client */
+void
+punyd_close(struct punyd *d)
+{
+	if (d == NULL)
+		return;
+	ddisconnect(d);
+	free(d);
+}
+
+/* punyd_enc: punyenc_host() through punycoded(8)
+ * The interface and the output are the same as punyenc_host()'s. d may be
+ * NULL, in which case it calls punyenc_host().
+ */
+size_t
+punyd_enc(struct punyd *d, char *restrict dst,
+    const char host[restrict static 1], size_t dstsize)
+{
+	size_t len;
+
+	if ((len = request(d, 'e', host, dst, dstsize)) == (size_t)-2)
+		len = punyenc_host(dst, host, dstsize);
+	return len;
+}
+
+/* punyd_dec: punydec_host() through punycoded(8)
+ * The interface and the output are the same as punydec_host()'s.
+ */
+size_t
+punyd_dec(struct punyd *d, char *restrict dst,
+    const char ace[restrict static 1], size_t dstsize)
+{
+	size_t len;
+
+	if ((len = request(d, 'd', ace, dst, dstsize)) == (size_t)-2)
+		len = punydec_host(dst, ace, dstsize);
+	return len;
+}
+
+/* request: send a request to the daemon and copy its answer to dst
+ * Returns the length of the answer, (size_t)-1 if the daemon said the
+ * hostname is invalid, or (size_t)-2 if the daemon can't answer it.
+ */
+static size_t
+request(struct punyd *d, int op, const char *name, char *dst, size_t dstsize)
+{
+	char req[linemax];
+	const char *p;
+	char *nl;
+	size_t len;
+	size_t off;
+	ssize_t r;
+
+	if (d == NULL)
+		return -2;
+	if (d->fd == -1) {
+		if (time(NULL) < d->retry)
+			return -2;
+		dconnect(d);
+		if (d->fd == -1)
+			return -2;
+	}
+	/* The protocol can't carry a newline. */
+	len = strlen(name);
+	if (len > sizeof(req) - 2 || memchr(name, '\n', len) != NULL)
+		return -2;
+
+	req[0] = op;
+	memcpy(req + 1, name, len);
+	req[len + 1] = '\n';
+	len += 2;
+	for (off = 0; off < len; off += r) {
+		r = send(d->fd, req + off, len - off, MSG_NOSIGNAL);
+		if (r == -1 && errno == EINTR) {
+			r = 0;
+			continue;
+		}
+		if (r == -1)
+			goto fail;
+	}
+
+	while ((nl = memchr(d->buf, '\n', d->len)) == NULL) {
+		if (d->len == sizeof(d->buf))
+			goto fail;
+		r = recv(d->fd, d->buf + d->len, sizeof(d->buf) - d->len, 0);
+		if (r == -1 && errno == EINTR)
+			continue;
+		if (r <= 0)
+			goto fail; /* Gone, or timed out. */
+		d->len += r;
+	}
+
+	if (d->buf[0] == '+') {
+		p = d->buf + 1;
+		len = nl - p;
+		if (dstsize > 0) {
+			off = len < dstsize ? len : dstsize-1;
+			memcpy(dst, p, off);
+			dst[off] = '\0';
+		}
+	} else if (d->buf[0] == '-' && nl == d->buf + 1) {
+		len = -1;
+	} else {
+		goto fail;
+	}
+	d->len -= nl+1 - d->buf;
+	memmove(d->buf, nl+1, d->len);
+	return len;
+
+fail:
+	ddisconnect(d);
+	d->retry = time(NULL) + 1;
+	return -2;
+}
+
+/* dconnect: connect to the daemon, leaves d->fd at -1 on failure */
+static void
+dconnect(struct punyd *d)
+{
+	struct timeval tv;
+
+	d->len = 0;
+	if ((d->fd = socket(AF_UNIX, SOCK_STREAM, 0)) == -1)
+		return;
+	(void)fcntl(d->fd, F_SETFD, FD_CLOEXEC);
+	tv.tv_sec = timeout_ms / 1000;
+	tv.tv_usec = timeout_ms % 1000 * 1000;
+	if (setsockopt(d->fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) == -1
+	    || setsockopt(d->fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv))
+	    == -1
+	    || connect(d->fd, (struct sockaddr *)&d->addr, sizeof(d->addr))
+	    == -1) {
+		ddisconnect(d);
+		d->retry = time(NULL) + 1;
+	}
+}
+
+static void
+ddisconnect(struct punyd *d)
+{
+	if (d->fd != -1)
+		close(d->fd);
+	d->fd = -1;
+	d->len = 0;
+}
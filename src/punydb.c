@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Database of precomputed encodings.
+ *
+ * The database is a file that is used straight from its mapping, nothing in it
+ * is parsed or copied when it's opened. It's laid out in the byte order of the
+ * machine that built it:
+ *
+ *	struct punydb		the header
+ *	struct slot[nslots]	hash table keyed by hostname
+ *	struct slot[nslots]	hash table keyed by ACE
+ *	struct entry[nentries]	hostname and ACE pairs
+ *	char[]			'\0' terminated strings the entries point to
+ *
+ * The hash tables use linear probing and are at most half full, so a miss ends
+ * at an empty slot after a couple of probes. A slot has the high half of the
+ * key's hash, so most slots that don't match are skipped without looking at
+ * the strings. The database is checked when it's opened and every offset is
+ * checked again when it's used, so a corrupt file can return wrong encodings
+ * but can't make a lookup read outside the mapping.
+ *
+ * Unlike libpunycode.c, this file needs mmap(2).
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "punycode.h"
+
+enum {
+	version = 1,
+	byteorder = 0x01020304,
+};
+
+static const char magic[8] = "punydb";
+
+/* The header, at offset 0 of the file. */
+struct punydb {
+	char magic[8];
+	uint32_t version;
+	uint32_t byteorder;	/* Tells the byte order of the file apart. */
+	uint64_t size;		/* Of the file. */
+	uint64_t seed;		/* Of the hash function. */
+	uint32_t nslots;	/* In each table, a power of 2. */
+	uint32_t nentries;
+	uint64_t slots;		/* Offsets from the start of the file. */
+	uint64_t entries;
+	uint64_t strings;
+};
+
+struct slot {
+	uint32_t tag;		/* The high half of the key's hash. */
+	uint32_t entry;		/* Index+1, 0 if the slot is empty. */
+};
+
+struct entry {
+	uint32_t host;		/* Offsets from the start of the strings. */
+	uint32_t ace;
+};
+
+static const char *lookup(const struct punydb *, const struct slot *, int,
+    const char *);
+static uint64_t hash(const char *, uint64_t);
+static int insert(struct slot *, uint32_t, const struct entry *, const char *,
+    int, uint64_t, uint32_t);
+static int writeall(int, const void *, size_t);
+
+/* punydb_open: map a database of precomputed encodings
+ * Maps the database at path, built by punydb_build(), and checks that it's
+ * sane. Nothing is allocated, the database is used straight from the mapping,
+ * so processes that open the same database share its pages.
+ *
+ * Returns NULL and sets errno on failure, errno is EINVAL if the file isn't a
+ * database of this version and byte order.
+ */
+const struct punydb *
+punydb_open(const char *path)
+{
+	const struct punydb *db;
+	struct stat st;
+	const char *p;
+	void *map;
+	int fd;
+	int error;
+
+	if ((fd = open(path, O_RDONLY | O_CLOEXEC)) == -1)
+		return NULL;
+	if (fstat(fd, &st) == -1) {
+		error = errno;
+		close(fd);
+		errno = error;
+		return NULL;
+	}
+	if ((uint64_t)st.st_size < sizeof(*db)
+	    || (uint64_t)st.st_size > SIZE_MAX) {
+		close(fd);
+		errno = EINVAL;
+		return NULL;
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	error = errno;
+	close(fd);
+	if (map == MAP_FAILED) {
+		errno = error;
+		return NULL;
+	}
+	db = map;
+	p = map;
+
+	if (memcmp(db->magic, magic, sizeof(magic)) != 0
+	    || db->version != version || db->byteorder != byteorder
+	    || db->size != (uint64_t)st.st_size
+	    || db->nslots == 0 || db->nslots > UINT32_MAX/2
+	    || (db->nslots & (db->nslots - 1)) != 0
+	    || db->slots != sizeof(*db)
+	    || db->entries != db->slots
+	    + (uint64_t)2 * sizeof(struct slot) * db->nslots
+	    || db->strings != db->entries
+	    + (uint64_t)sizeof(struct entry) * db->nentries
+	    || db->strings >= db->size || p[db->size - 1] != '\0') {
+		munmap(map, st.st_size);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	/* Lookups hit random pages, don't read ahead. */
+	(void)posix_madvise(map, st.st_size, POSIX_MADV_RANDOM);
+	return db;
+}
+
+/* punydb_close: unmap a database opened by punydb_open() */
+void
+punydb_close(const struct punydb *db)
+{
+	if (db != NULL)
+		munmap((void *)db, db->size);
+}
+
+/* punydb_enc: look up the ACE form of a hostname
+ * Looks up the case-folded UTF-8 hostname in host, see punyenc_host().
+ *
+ * Returns the ACE form, which lives as long as the database, or NULL if the
+ * hostname isn't in the database.
+ */
+const char *
+punydb_enc(const struct punydb *db, const char host[static 1])
+{
+	return lookup(db, (const struct slot *)((const char *)db + db->slots),
+	    0, host);
+}
+
+/* punydb_dec: look up the hostname an ACE form was built from
+ * The inverse of punydb_enc(). The ACE form must be in lowercase, like
+ * punyenc_host() writes it.
+ */
+const char *
+punydb_dec(const struct punydb *db, const char ace[static 1])
+{
+	return lookup(db, (const struct slot *)((const char *)db + db->slots)
+	    + db->nslots, 1, ace);
+}
+
+/* punyenc_db: punyenc_host() with a database of precomputed encodings
+ * Copies the ACE form of host from db if it's there, otherwise encodes it with
+ * punyenc_host(). db may be NULL. The interface and the output are the same as
+ * punyenc_host()'s.
+ */
+size_t
+punyenc_db(const struct punydb *db, char *restrict dst,
+    const char host[restrict static 1], size_t dstsize)
+{
+	const char *ace;
+	size_t len;
+
+	if (db == NULL || (ace = punydb_enc(db, host)) == NULL)
+		return punyenc_host(dst, host, dstsize);
+
+	len = strlen(ace);
+	if (dstsize > 0) {
+		if (len < dstsize) {
+			memcpy(dst, ace, len+1);
+		} else {
+			memcpy(dst, ace, dstsize-1);
+			dst[dstsize-1] = '\0';
+		}
+	}
+	return len;
+}
+
+/* lookup: look key up in one of the tables of db
+ * The key of the table is the ACE form of an entry if ace is nonzero,
+ * otherwise it's the hostname. Returns the other string of the entry.
+ */
+static const char *
+lookup(const struct punydb *db, const struct slot *table, int ace,
+    const char *key)
+{
+	const struct entry *entries;
+	const struct entry *e;
+	const char *strings;
+	uint64_t poolsize;
+	uint64_t h;
+	uint32_t mask;
+	uint32_t i, n;
+	uint32_t k, v;
+
+	entries = (const struct entry *)((const char *)db + db->entries);
+	strings = (const char *)db + db->strings;
+	poolsize = db->size - db->strings;
+	mask = db->nslots - 1;
+	h = hash(key, db->seed);
+	/* A corrupt table could be full, give up after visiting every slot. */
+	for (i = h & mask, n = 0; n < db->nslots; i = (i+1) & mask, n++) {
+		if (table[i].entry == 0)
+			return NULL;
+		if (table[i].tag != h >> 32 || table[i].entry > db->nentries)
+			continue;
+		e = &entries[table[i].entry - 1];
+		k = ace ? e->ace : e->host;
+		v = ace ? e->host : e->ace;
+		if (k >= poolsize || v >= poolsize)
+			continue;
+		if (strcmp(strings + k, key) == 0)
+			return strings + v;
+	}
+	return NULL;
+}
+
+/* hash: seeded FNV-1a of s, mixed so the low bits make a good index */
+static uint64_t
+hash(const char *s, uint64_t seed)
+{
+	uint64_t h = 0xcbf29ce484222325 ^ seed;
+
+	while (*s != '\0') {
+		h ^= (unsigned char)*s++;
+		h *= 0x100000001b3;
+	}
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccd;
+	h ^= h >> 33;
+	return h;
+}
+
+/* punydb_build: write a database of precomputed encodings
+ * Encodes the n case-folded UTF-8 hostnames in hosts with punyenc_host() and
+ * writes a database of them to fd, for punydb_open(). Hostnames made of ASCII
+ * alone aren't stored, their ACE form is themselves. If a hostname or an ACE
+ * form is repeated, the first one wins.
+ *
+ * Returns 0 on success. Returns -1 and sets errno on failure, errno is EINVAL
+ * if a hostname can't be encoded, and EFBIG if the database would be too
+ * large.
+ */
+int
+punydb_build(int fd, const char *const hosts[], size_t n)
+{
+	struct punydb hdr;
+	struct slot *slots = NULL;
+	struct entry *entries = NULL;
+	char *strings = NULL;
+	size_t poolsize = 0;
+	size_t poolcap = 0;
+	size_t nentries = 0;
+	size_t nslots;
+	size_t hostlen;
+	size_t acelen;
+	size_t i;
+	const char *s;
+	struct entry *e;
+	void *tmp;
+	int rval = -1;
+
+	if (n > UINT32_MAX/4) {
+		errno = EFBIG;
+		return -1;
+	}
+	for (nslots = 1; nslots < 2*n; nslots *= 2)
+		;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, magic, sizeof(magic));
+	hdr.version = version;
+	hdr.byteorder = byteorder;
+	hdr.seed = 0x9e3779b97f4a7c15;
+	hdr.nslots = nslots;
+
+	if ((slots = calloc(2*nslots, sizeof(*slots))) == NULL
+	    || (n > 0 && (entries = calloc(n, sizeof(*entries))) == NULL))
+		goto end;
+
+	for (i = 0; i < n; i++) {
+		for (s = hosts[i]; *s != '\0' && !(*s & 0x80); s++)
+			;
+		if (*s == '\0')
+			continue;
+
+		if ((acelen = punyenc_host(NULL, hosts[i], 0)) == (size_t)-1) {
+			errno = EINVAL;
+			goto end;
+		}
+		hostlen = s - hosts[i] + strlen(s);
+		if (poolsize + hostlen + acelen + 2 > UINT32_MAX) {
+			errno = EFBIG;
+			goto end;
+		}
+		if (poolsize + hostlen + acelen + 2 > poolcap) {
+			poolcap = poolcap * 2 > poolsize + hostlen + acelen + 2
+			    ? poolcap * 2 : poolsize + hostlen + acelen + 2;
+			if ((tmp = realloc(strings, poolcap)) == NULL)
+				goto end;
+			strings = tmp;
+		}
+		e = &entries[nentries];
+		e->host = poolsize;
+		memcpy(strings + poolsize, hosts[i], hostlen+1);
+		e->ace = poolsize + hostlen + 1;
+		(void)punyenc_host(strings + e->ace, hosts[i], acelen+1);
+
+		/* Drop the entry if its hostname is already there. */
+		if (!insert(slots, nslots, entries, strings, 0, hdr.seed,
+		    nentries))
+			continue;
+		(void)insert(slots + nslots, nslots, entries, strings, 1,
+		    hdr.seed, nentries);
+		nentries++;
+		poolsize += hostlen + acelen + 2;
+	}
+
+	/* The strings end in a '\0' even if there are none. */
+	if (poolsize == 0) {
+		if ((tmp = realloc(strings, 1)) == NULL)
+			goto end;
+		strings = tmp;
+		strings[poolsize++] = '\0';
+	}
+
+	hdr.nentries = nentries;
+	hdr.slots = sizeof(hdr);
+	hdr.entries = hdr.slots + 2 * nslots * sizeof(*slots);
+	hdr.strings = hdr.entries + nentries * sizeof(*entries);
+	hdr.size = hdr.strings + poolsize;
+	if (writeall(fd, &hdr, sizeof(hdr)) == -1
+	    || writeall(fd, slots, 2 * nslots * sizeof(*slots)) == -1
+	    || writeall(fd, entries, nentries * sizeof(*entries)) == -1
+	    || writeall(fd, strings, poolsize) == -1)
+		goto end;
+	rval = 0;
+end:
+	free(strings);
+	free(entries);
+	free(slots);
+	return rval;
+}
+
+/* insert: insert entries[index] in a table of the database being built
+ * The key is the entry's ACE form if ace is nonzero, otherwise its hostname.
+ * Returns 0 if the key is already in the table, 1 otherwise.
+ */
+static int
+insert(struct slot *table, uint32_t nslots, const struct entry *entries,
+    const char *strings, int ace, uint64_t seed, uint32_t index)
+{
+	const struct entry *e;
+	const char *key;
+	uint64_t h;
+	uint32_t i;
+
+	key = strings + (ace ? entries[index].ace : entries[index].host);
+	h = hash(key, seed);
+	for (i = h & (nslots-1); table[i].entry != 0; i = (i+1) & (nslots-1)) {
+		e = &entries[table[i].entry - 1];
+		if (table[i].tag == h >> 32
+		    && strcmp(strings + (ace ? e->ace : e->host), key) == 0)
+			return 0;
+	}
+	table[i].tag = h >> 32;
+	table[i].entry = index + 1;
+	return 1;
+}
+
+/* writeall: write(2) all len bytes of buf */
+static int
+writeall(int fd, const void *buf, size_t len)
+{
+	const char *p = buf;
+	ssize_t w;
+
+	while (len > 0) {
+		if ((w = write(fd, p, len)) == -1) {
+			if (errno == EINTR)
+				continue;
+			return -1;
+		}
+		p += w;
+		len -= w;
+	}
+	return 0;
+}
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Thread pool for the batch functions.
+ *
+ * The rows of a column are split into chunks which the threads claim one at a
+ * time, so a thread that got short rows simply claims more chunks than the
+ * others. Every thread encodes its chunks into its own arena, and once all
+ * chunks are done, the calling thread concatenates them into dst in row order
+ * and fixes up the offsets. The result is the same no matter how many threads
+ * there are or which thread got which chunk.
+ *
+ * Unlike libpunycode.c, this file needs POSIX threads.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "punycode.h"
+
+enum {
+	/* Rows per chunk. */
+	chunkrows = 1024,
+};
+
+typedef size_t batchfn(const char *restrict, const uint32_t *restrict, size_t,
+    char *restrict, size_t, uint32_t *restrict, unsigned char *restrict);
+
+struct job {
+	batchfn *fn;
+	const char *data;
+	const uint32_t *offsets;
+	size_t n;
+	uint32_t *dstoffsets;
+	unsigned char *status;
+	int error;
+};
+
+/* A chunk's output, stored in the arena of the thread that encoded it. */
+struct chunk {
+	int thread;
+	size_t off;
+	size_t len;
+};
+
+struct arena {
+	char *buf;
+	size_t size;
+	size_t used;
+};
+
+struct punypool {
+	pthread_mutex_t mtx;
+	pthread_cond_t work;	/* A job was posted or the pool is closing. */
+	pthread_cond_t done;	/* A thread is done with the job. */
+	pthread_t *threads;
+	int nthreads;		/* Including the caller. */
+	struct arena *arenas;	/* One per thread, 0 is the caller's. */
+
+	unsigned long gen;	/* Incremented on every job. */
+	int busy;		/* Threads still working on the job. */
+	int quit;
+	struct job *job;
+	size_t next;		/* Next chunk to claim. */
+	struct chunk *chunks;
+	size_t chunkcap;
+};
+
+struct worker {
+	struct punypool *pool;
+	int id;
+};
+
+static size_t runbatch(struct punypool *, batchfn *, const char *,
+    const uint32_t *, size_t, char *, size_t, uint32_t *, unsigned char *);
+static void *worker(void *);
+static void work(struct punypool *, int);
+static int dochunk(struct punypool *, int, size_t);
+
+/* punypool_new: create a thread pool for the batch functions
+ * Creates a pool of nthreads threads, counting the thread that calls the batch
+ * functions. If nthreads <= 0, uses one thread per online CPU.
+ *
+ * Returns NULL and sets errno on failure.
+ */
+struct punypool *
+punypool_new(int nthreads)
+{
+	struct punypool *pool;
+	struct worker *w;
+	long ncpu;
+	int i;
+	int error;
+
+	if (nthreads <= 0) {
+		ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+		nthreads = ncpu > 0 && ncpu < 1024 ? ncpu : 1;
+	}
+
+	if ((pool = calloc(1, sizeof(*pool))) == NULL)
+		return NULL;
+	pool->nthreads = nthreads;
+	pool->threads = calloc(nthreads, sizeof(*pool->threads));
+	pool->arenas = calloc(nthreads, sizeof(*pool->arenas));
+	if (pool->threads == NULL || pool->arenas == NULL) {
+		free(pool->threads);
+		free(pool->arenas);
+		free(pool);
+		return NULL;
+	}
+	pthread_mutex_init(&pool->mtx, NULL);
+	pthread_cond_init(&pool->work, NULL);
+	pthread_cond_init(&pool->done, NULL);
+
+	for (i = 1; i < nthreads; i++) {
+		if ((w = malloc(sizeof(*w))) == NULL) {
+			error = errno;
+			goto fail;
+		}
+		w->pool = pool;
+		w->id = i;
+		if ((error = pthread_create(&pool->threads[i], NULL, worker,
+		    w)) != 0) {
+			free(w);
+			goto fail;
+		}
+	}
+	return pool;
+
+fail:
+	/* Only the first i threads exist. */
+	pool->nthreads = i;
+	punypool_free(pool);
+	errno = error;
+	return NULL;
+}
+
+/* punypool_free: stop the threads of a pool and free it */
+void
+punypool_free(struct punypool *pool)
+{
+	int i;
+
+	if (pool == NULL)
+		return;
+
+	pthread_mutex_lock(&pool->mtx);
+	pool->quit = 1;
+	pthread_cond_broadcast(&pool->work);
+	pthread_mutex_unlock(&pool->mtx);
+	for (i = 1; i < pool->nthreads; i++)
+		pthread_join(pool->threads[i], NULL);
+
+	for (i = 0; i < pool->nthreads; i++)
+		free(pool->arenas[i].buf);
+	pthread_cond_destroy(&pool->done);
+	pthread_cond_destroy(&pool->work);
+	pthread_mutex_destroy(&pool->mtx);
+	free(pool->chunks);
+	free(pool->arenas);
+	free(pool->threads);
+	free(pool);
+}
+
+/* punyenc_batch_pool: punyenc_batch() on a thread pool
+ * The interface and the output are the same as punyenc_batch()'s, except that
+ * it also returns (size_t)-1 and sets errno if it runs out of memory.
+ *
+ * A pool runs one batch at a time, don't share it between threads that call
+ * the batch functions concurrently.
+ */
+size_t
+punyenc_batch_pool(struct punypool *pool, const char *restrict data,
+    const uint32_t *restrict offsets, size_t n, char *restrict dst,
+    size_t dstsize, uint32_t *restrict dstoffsets,
+    unsigned char *restrict status)
+{
+	return runbatch(pool, punyenc_batch, data, offsets, n, dst, dstsize,
+	    dstoffsets, status);
+}
+
+/* punydec_batch_pool: punydec_batch() on a thread pool
+ * The interface is the same as punyenc_batch_pool()'s.
+ */
+size_t
+punydec_batch_pool(struct punypool *pool, const char *restrict data,
+    const uint32_t *restrict offsets, size_t n, char *restrict dst,
+    size_t dstsize, uint32_t *restrict dstoffsets,
+    unsigned char *restrict status)
+{
+	return runbatch(pool, punydec_batch, data, offsets, n, dst, dstsize,
+	    dstoffsets, status);
+}
+
+/* runbatch: run the batch function fn on the pool */
+static size_t
+runbatch(struct punypool *pool, batchfn *fn, const char *data,
+    const uint32_t *offsets, size_t n, char *dst, size_t dstsize,
+    uint32_t *dstoffsets, unsigned char *status)
+{
+	struct job job;
+	struct chunk *c;
+	struct arena *a;
+	size_t nchunks;
+	size_t pos;
+	size_t i, j;
+	size_t end;
+	void *tmp;
+
+	nchunks = n / chunkrows + (n % chunkrows != 0);
+	if (nchunks > pool->chunkcap) {
+		if ((tmp = realloc(pool->chunks, nchunks * sizeof(*c))) == NULL)
+			return -1;
+		pool->chunks = tmp;
+		pool->chunkcap = nchunks;
+	}
+	for (i = 0; i < (size_t)pool->nthreads; i++)
+		pool->arenas[i].used = 0;
+
+	job.fn = fn;
+	job.data = data;
+	job.offsets = offsets;
+	job.n = n;
+	job.dstoffsets = dstoffsets;
+	job.status = status;
+	job.error = 0;
+
+	/* Post the job and work on it alongside the other threads. */
+	pthread_mutex_lock(&pool->mtx);
+	pool->job = &job;
+	pool->next = 0;
+	pool->busy = pool->nthreads - 1;
+	pool->gen++;
+	pthread_cond_broadcast(&pool->work);
+	pthread_mutex_unlock(&pool->mtx);
+
+	work(pool, 0);
+
+	pthread_mutex_lock(&pool->mtx);
+	while (pool->busy > 0)
+		pthread_cond_wait(&pool->done, &pool->mtx);
+	pool->job = NULL;
+	pthread_mutex_unlock(&pool->mtx);
+
+	if (job.error) {
+		errno = job.error;
+		return -1;
+	}
+
+	/*
+	 * Concatenate the chunks in row order. Each chunk's offsets are
+	 * relative to the start of the chunk.
+	 */
+	dstoffsets[0] = pos = 0;
+	for (i = 0; i < nchunks; i++) {
+		c = &pool->chunks[i];
+		a = &pool->arenas[c->thread];
+		if (c->len > UINT32_MAX - pos)
+			return -1;
+		if (pos < dstsize) {
+			memcpy(dst + pos, a->buf + c->off,
+			    c->len < dstsize - pos ? c->len : dstsize - pos);
+		}
+		end = (i+1) * chunkrows < n ? (i+1) * chunkrows : n;
+		for (j = i * chunkrows + 1; j <= end; j++)
+			dstoffsets[j] += pos;
+		pos += c->len;
+	}
+	return pos;
+}
+
+static void *
+worker(void *arg)
+{
+	struct worker *w = arg;
+	struct punypool *pool = w->pool;
+	int id = w->id;
+	unsigned long seen = 0;
+
+	free(w);
+	pthread_mutex_lock(&pool->mtx);
+	for (;;) {
+		while (pool->gen == seen && !pool->quit)
+			pthread_cond_wait(&pool->work, &pool->mtx);
+		if (pool->quit)
+			break;
+		seen = pool->gen;
+		pthread_mutex_unlock(&pool->mtx);
+
+		work(pool, id);
+
+		pthread_mutex_lock(&pool->mtx);
+		if (--pool->busy == 0)
+			pthread_cond_signal(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->mtx);
+	return NULL;
+}
+
+/* work: claim and encode chunks until there are none left */
+static void
+work(struct punypool *pool, int id)
+{
+	size_t c;
+	size_t nchunks;
+	int error;
+
+	nchunks = pool->job->n / chunkrows + (pool->job->n % chunkrows != 0);
+	for (;;) {
+		pthread_mutex_lock(&pool->mtx);
+		c = pool->next++;
+		pthread_mutex_unlock(&pool->mtx);
+		if (c >= nchunks)
+			return;
+
+		if ((error = dochunk(pool, id, c)) != 0) {
+			pthread_mutex_lock(&pool->mtx);
+			pool->job->error = error;
+			pthread_mutex_unlock(&pool->mtx);
+		}
+	}
+}
+
+/* dochunk: encode chunk c into the arena of thread id
+ *
+ * Returns 0 on success, an errno value on failure.
+ */
+static int
+dochunk(struct punypool *pool, int id, size_t c)
+{
+	struct job *job = pool->job;
+	struct arena *a = &pool->arenas[id];
+	uint32_t off[chunkrows + 1];
+	char *p;
+	size_t start;
+	size_t rows;
+	size_t len;
+	size_t size;
+	void *tmp;
+
+	start = c * chunkrows;
+	rows = job->n - start < chunkrows ? job->n - start : chunkrows;
+	for (;;) {
+		p = a->buf != NULL ? a->buf + a->used : NULL;
+		len = job->fn(job->data, job->offsets + start, rows, p,
+		    a->size - a->used, off,
+		    job->status != NULL ? job->status + start : NULL);
+		if (len == (size_t)-1)
+			return ERANGE;
+		if (len <= a->size - a->used)
+			break;
+
+		/* The arena is too small, grow it and do it again. */
+		size = a->size * 2 > a->used + len ? a->size * 2
+		    : a->used + len;
+		if ((tmp = realloc(a->buf, size)) == NULL)
+			return ENOMEM;
+		a->buf = tmp;
+		a->size = size;
+	}
+
+	memcpy(job->dstoffsets + start + 1, off + 1, rows * sizeof(*off));
+	pool->chunks[c].thread = id;
+	pool->chunks[c].off = a->used;
+	pool->chunks[c].len = len;
+	a->used += len;
+	return 0;
+}
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Per-phase profiler for the encoder.
+ *
+ * The encoder calls punyprof_phase() every time it moves on to another phase,
+ * and the counts since the previous call are charged to the previous phase.
+ * The counters are a perf_event group of cycles, instructions, branch misses
+ * and L1D read misses, counted in user space for the calling thread only.
+ *
+ * On x86, the counters are read with RDPMC through the pages the kernel maps
+ * for them, which costs tens of cycles instead of a system call. Elsewhere, or
+ * if the kernel doesn't allow RDPMC, the group is read with read(2). If there
+ * is no perf_event_open(2) at all, only the time is measured, in nanoseconds.
+ * The cost of a measurement is calibrated once and subtracted.
+ *
+ * Unless the library is built with PUNYCODE_PROFILE, the encoder doesn't call
+ * into this file and the functions report that there is no profile.
+ */
+
+#include <string.h>
+
+#include "punycode.h"
+
+#if defined(PUNYCODE_PROFILE)
+
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+enum {
+	ncounters = 4,
+	/* Phase number of "not in the encoder". */
+	idle = PUNYPROF_PHASES,
+};
+
+struct prof {
+	int init;
+	int source;		/* PUNYPROF_HW or PUNYPROF_CLOCK. */
+	int phase;
+	int fd[ncounters];
+	void *page[ncounters];	/* Mapped perf_event_mmap_page of each fd. */
+	int rdpmc;		/* Whether the pages can be used. */
+	uint_least64_t last[ncounters];
+	uint_least64_t cost[ncounters];	/* Cost of a measurement. */
+	struct punyprof p[PUNYPROF_PHASES];
+};
+
+static __thread struct prof prof;
+
+void punyprof_phase(int);
+static void init(struct prof *);
+static void measure(struct prof *, uint_least64_t [static ncounters]);
+#if defined(__linux__)
+static int hwopen(struct prof *);
+static int hwread(struct prof *, uint_least64_t [static ncounters]);
+#endif
+
+/* punyprof_get: get the calling thread's encoder profile
+ * Puts the counts of every phase since the last call to punyprof_reset() in
+ * prof[0] to prof[PUNYPROF_PHASES-1].
+ *
+ * Returns PUNYPROF_HW if the counts come from the hardware counters,
+ * PUNYPROF_CLOCK if only the time is known, in which case the cycles member
+ * holds nanoseconds and the others are 0, or -1 if the library was built
+ * without profiling, in which case prof is zeroed.
+ */
+int
+punyprof_get(struct punyprof prof_[static PUNYPROF_PHASES])
+{
+	init(&prof);
+	memcpy(prof_, prof.p, sizeof(prof.p));
+	return prof.source;
+}
+
+/* punyprof_reset: restart the calling thread's encoder profile from 0 */
+void
+punyprof_reset(void)
+{
+	init(&prof);
+	memset(prof.p, 0, sizeof(prof.p));
+}
+
+/* punyprof_phase: charge the counts since the last call to the current phase,
+ * then switch to phase
+ */
+void
+punyprof_phase(int phase)
+{
+	uint_least64_t now[ncounters];
+	uint_least64_t d;
+	struct punyprof *p;
+	int i;
+
+	init(&prof);
+	measure(&prof, now);
+	if (prof.phase != idle) {
+		p = &prof.p[prof.phase];
+		p->calls++;
+		for (i = 0; i < ncounters; i++) {
+			d = now[i] - prof.last[i];
+			d = d > prof.cost[i] ? d - prof.cost[i] : 0;
+			switch (i) {
+			case 0: p->cycles += d; break;
+			case 1: p->instructions += d; break;
+			case 2: p->branchmisses += d; break;
+			case 3: p->l1dmisses += d; break;
+			}
+		}
+	}
+	prof.phase = phase;
+	/* Don't charge the rest of this function to the next phase. */
+	measure(&prof, prof.last);
+}
+
+/* init: open the counters and calibrate them on first use */
+static void
+init(struct prof *pr)
+{
+	uint_least64_t a[ncounters], b[ncounters];
+	int i, j;
+
+	if (pr->init)
+		return;
+	pr->init = 1;
+	pr->phase = idle;
+	pr->source = PUNYPROF_CLOCK;
+#if defined(__linux__)
+	if (hwopen(pr) == 0)
+		pr->source = PUNYPROF_HW;
+#endif
+
+	/* The cost is the smallest difference between 2 measurements. */
+	for (i = 0; i < ncounters; i++)
+		pr->cost[i] = UINT_LEAST64_MAX;
+	for (j = 0; j < 64; j++) {
+		measure(pr, a);
+		measure(pr, b);
+		for (i = 0; i < ncounters; i++) {
+			if (b[i] - a[i] < pr->cost[i])
+				pr->cost[i] = b[i] - a[i];
+		}
+	}
+}
+
+/* measure: read the counters into v */
+static void
+measure(struct prof *pr, uint_least64_t v[static ncounters])
+{
+	struct timespec ts;
+
+#if defined(__linux__)
+	if (pr->source == PUNYPROF_HW && hwread(pr, v) == 0)
+		return;
+#endif
+	memset(v, 0, ncounters * sizeof(*v));
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	v[0] = (uint_least64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+#if defined(__linux__)
+/* hwopen: open the perf_event group
+ * Returns 0 on success, -1 if the hardware counters aren't available.
+ */
+static int
+hwopen(struct prof *pr)
+{
+	static const struct {
+		uint32_t type;
+		uint64_t config;
+	} ev[ncounters] = {
+		{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+		{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+		{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+		{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+		    | PERF_COUNT_HW_CACHE_OP_READ << 8
+		    | PERF_COUNT_HW_CACHE_RESULT_MISS << 16},
+	};
+	struct perf_event_attr attr;
+	struct perf_event_mmap_page *pc;
+	long pagesz = sysconf(_SC_PAGESIZE);
+	int i;
+
+	for (i = 0; i < ncounters; i++) {
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = ev[i].type;
+		attr.config = ev[i].config;
+		attr.read_format = PERF_FORMAT_GROUP;
+		attr.disabled = i == 0;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		pr->fd[i] = syscall(SYS_perf_event_open, &attr, 0, -1,
+		    i == 0 ? -1 : pr->fd[0], 0);
+		if (pr->fd[i] == -1)
+			goto fail;
+	}
+
+	pr->rdpmc = 1;
+	for (i = 0; i < ncounters; i++) {
+		pr->page[i] = mmap(NULL, pagesz, PROT_READ, MAP_SHARED,
+		    pr->fd[i], 0);
+		if (pr->page[i] == MAP_FAILED) {
+			pr->page[i] = NULL;
+			pr->rdpmc = 0;
+		}
+	}
+	ioctl(pr->fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	for (i = 0; pr->rdpmc && i < ncounters; i++) {
+		pc = pr->page[i];
+		if (!pc->cap_user_rdpmc || pc->index == 0)
+			pr->rdpmc = 0;
+	}
+#if !defined(__x86_64__) && !defined(__i386__)
+	pr->rdpmc = 0;
+#endif
+	return 0;
+
+fail:
+	while (i-- > 0)
+		close(pr->fd[i]);
+	return -1;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static uint64_t
+rdpmc(uint32_t counter)
+{
+	uint32_t lo, hi;
+
+	__asm__ volatile("rdpmc" : "=a"(lo), "=d"(hi) : "c"(counter));
+	return lo | (uint64_t)hi << 32;
+}
+#endif
+
+/* hwread: read the counters into v
+ * Returns 0 on success, -1 on failure.
+ */
+static int
+hwread(struct prof *pr, uint_least64_t v[static ncounters])
+{
+	uint64_t buf[1 + ncounters];
+	int i;
+
+#if defined(__x86_64__) || defined(__i386__)
+	struct perf_event_mmap_page *pc;
+	uint32_t seq;
+	uint32_t idx;
+	uint64_t count;
+	int64_t pmc;
+
+	/* See the comment above struct perf_event_mmap_page. */
+	for (i = 0; pr->rdpmc && i < ncounters; i++) {
+		pc = pr->page[i];
+		do {
+			seq = pc->lock;
+			__atomic_signal_fence(__ATOMIC_SEQ_CST);
+			idx = pc->index;
+			count = pc->offset;
+			if (idx == 0)
+				break;
+			pmc = rdpmc(idx - 1);
+			pmc = (int64_t)((uint64_t)pmc << (64 - pc->pmc_width))
+			    >> (64 - pc->pmc_width);
+			count += pmc;
+			__atomic_signal_fence(__ATOMIC_SEQ_CST);
+		} while (pc->lock != seq);
+		if (idx == 0)
+			break;
+		v[i] = count;
+	}
+	if (pr->rdpmc && i == ncounters)
+		return 0;
+#endif
+
+	if (read(pr->fd[0], buf, sizeof(buf)) != sizeof(buf))
+		return -1;
+	for (i = 0; i < ncounters; i++)
+		v[i] = buf[1 + i];
+	return 0;
+}
+#endif /* defined(__linux__) */
+
+#else /* !defined(PUNYCODE_PROFILE) */
+
+int
+punyprof_get(struct punyprof prof[static PUNYPROF_PHASES])
+{
+	memset(prof, 0, PUNYPROF_PHASES * sizeof(*prof));
+	return -1;
+}
+
+void
+punyprof_reset(void)
+{
+}
+
+#endif
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Encoder statistics.
+ *
+ * Every thread counts into its own struct punystats, which only that thread
+ * writes to, so counting is a plain increment. The structs are linked into a
+ * list that punystats_get() sums up, and a thread's counts are moved into a
+ * global struct when it exits.
+ *
+ * Unless the library is built with PUNYCODE_STATS, the encoder doesn't call
+ * into this file and the functions report that there are no statistics.
+ */
+
+#include <string.h>
+
+#include "punycode.h"
+
+#if defined(PUNYCODE_STATS)
+
+#include <pthread.h>
+#include <stdlib.h>
+
+struct tstats {
+	struct punystats s;
+	struct tstats *next;
+	struct tstats *prev;
+};
+
+static pthread_mutex_t mtx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t key;
+static struct tstats *threads;		/* Counters of running threads. */
+static struct punystats retired;	/* Counters of exited threads. */
+static struct punystats baseline;	/* Counts at the last reset. */
+static __thread struct tstats *mine;
+
+void punystats_input(size_t);
+void punystats_label(size_t, uint_least32_t, uint_least32_t);
+static struct punystats *get(void);
+static void mkkey(void);
+static void retire(void *);
+static void sum(struct punystats *, const struct punystats *, int);
+static int bucket(uint_least32_t);
+
+/*
+ * The counters are read while their thread writes to them. Relaxed atomic
+ * loads and stores make that well defined and compile to plain moves.
+ */
+#define INC(x, n) __atomic_store_n(&(x), (x) + (n), __ATOMIC_RELAXED)
+#define LOAD(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+
+/* punystats_get: get the encoder statistics
+ * Puts the statistics of all threads since the last call to punystats_reset()
+ * in *stats.
+ *
+ * Returns 0, or -1 if the library was built without statistics, in which case
+ * *stats is zeroed.
+ */
+int
+punystats_get(struct punystats *stats)
+{
+	struct tstats *t;
+
+	pthread_mutex_lock(&mtx);
+	*stats = retired;
+	for (t = threads; t != NULL; t = t->next)
+		sum(stats, &t->s, 1);
+	sum(stats, &baseline, -1);
+	pthread_mutex_unlock(&mtx);
+	return 0;
+}
+
+/* punystats_reset: restart the encoder statistics from 0 */
+void
+punystats_reset(void)
+{
+	struct tstats *t;
+
+	/* Threads are never written to by others, remember their counts. */
+	pthread_mutex_lock(&mtx);
+	baseline = retired;
+	for (t = threads; t != NULL; t = t->next)
+		sum(&baseline, &t->s, 1);
+	pthread_mutex_unlock(&mtx);
+}
+
+/* punystats_input: count input bytes */
+void
+punystats_input(size_t bytes)
+{
+	struct punystats *s;
+
+	if ((s = get()) != NULL)
+		INC(s->inbytes, bytes);
+}
+
+/* punystats_label: count an encoded label
+ * rval is the encoder's return value, cplen the amount of codepoints and
+ * ndistinct the amount of distinct non-basic codepoints.
+ */
+void
+punystats_label(size_t rval, uint_least32_t cplen, uint_least32_t ndistinct)
+{
+	struct punystats *s;
+
+	if ((s = get()) == NULL)
+		return;
+	INC(s->labels, 1);
+	if (rval == (size_t)-1) {
+		INC(s->overflows, 1);
+	} else if (rval == (size_t)-2) {
+		INC(s->toolong, 1);
+	} else if (rval != (size_t)-3) {
+		/* (size_t)-3 is a sink that stopped the encoder early. */
+		INC(s->outbytes, rval);
+		if (ndistinct == 0)
+			INC(s->ascii, 1);
+	}
+	INC(s->inlen[bucket(cplen)], 1);
+	INC(s->distinct[bucket(ndistinct)], 1);
+}
+
+/* get: get the calling thread's counters, NULL if out of memory */
+static struct punystats *
+get(void)
+{
+	struct tstats *t;
+
+	if (mine != NULL)
+		return &mine->s;
+
+	pthread_once(&once, mkkey);
+	if ((t = calloc(1, sizeof(*t))) == NULL)
+		return NULL;
+	pthread_mutex_lock(&mtx);
+	if ((t->next = threads) != NULL)
+		threads->prev = t;
+	threads = t;
+	pthread_mutex_unlock(&mtx);
+	pthread_setspecific(key, t);
+	mine = t;
+	return &t->s;
+}
+
+static void
+mkkey(void)
+{
+	pthread_key_create(&key, retire);
+}
+
+/* retire: move the counters of an exiting thread to the global counters */
+static void
+retire(void *arg)
+{
+	struct tstats *t = arg;
+
+	pthread_mutex_lock(&mtx);
+	sum(&retired, &t->s, 1);
+	if (t->prev != NULL)
+		t->prev->next = t->next;
+	else
+		threads = t->next;
+	if (t->next != NULL)
+		t->next->prev = t->prev;
+	pthread_mutex_unlock(&mtx);
+	free(t);
+}
+
+/* sum: add sign * *src to *dst */
+static void
+sum(struct punystats *dst, const struct punystats *src, int sign)
+{
+	int i;
+
+	dst->labels += sign * LOAD(src->labels);
+	dst->ascii += sign * LOAD(src->ascii);
+	dst->overflows += sign * LOAD(src->overflows);
+	dst->toolong += sign * LOAD(src->toolong);
+	dst->inbytes += sign * LOAD(src->inbytes);
+	dst->outbytes += sign * LOAD(src->outbytes);
+	for (i = 0; i < PUNYSTATS_BUCKETS; i++) {
+		dst->inlen[i] += sign * LOAD(src->inlen[i]);
+		dst->distinct[i] += sign * LOAD(src->distinct[i]);
+	}
+}
+
+/* bucket: histogram bucket of x, see struct punystats */
+static int
+bucket(uint_least32_t x)
+{
+	int b;
+
+	for (b = 0; x != 0 && b < PUNYSTATS_BUCKETS-1; b++)
+		x >>= 1;
+	return b;
+}
+
+#else /* !defined(PUNYCODE_STATS) */
+
+int
+punystats_get(struct punystats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	return -1;
+}
+
+void
+punystats_reset(void)
+{
+}
+
+#endif
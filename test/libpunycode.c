@@ -16,20 +16,135 @@
 
 #include <ctype.h>
 #include <err.h>
+#include <errno.h>
 #include <locale.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <strings.h>
 #include <wchar.h>
 #include <wctype.h>
+#include <unistd.h>
 
 #include <punycode.h>
 
 #include "punytest.h"
 
 static void punytest(const char *, const char *);
+static void punydectest(const char *, const char *);
+static void wiretest(const char *, const char *, size_t);
+static void idnatest(const char *, int);
+static void utftest(const char *, const char *);
+static void longtest(void);
+static void masktest(void);
+static void captest(const char *);
+static void batchtest(void);
+static void pooltest(void);
+static void statstest(void);
+static void dbtest(void);
+static void cmptest(const char *);
+static void spantest(const char *);
+static void casetest(const char *, const char *, const char *);
+static int spancat(void *, const char *, size_t);
+static size_t u8tou32(uint_least32_t *, const char *);
+static size_t u32tou16(uint_least16_t *, const uint_least32_t *);
+static int u32casecmp(const uint_least32_t *, const uint_least32_t *);
 static void mbstowlower(char [static 1]);
 
+/* Invalid input for the decoder. */
+static const char *const badpuny[] = {
+	"ü-a",		/* Non-basic code point before the delimiter. */
+	"-abc",		/* Delimiter in front of the extended code points. */
+	"a-!",		/* Invalid digit. */
+	"a-@", "a-[", "a-`", "a-{", "a-/", "a-:", "a-\xe9",
+	"a-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbb@b",	/* After a block of 16. */
+	"a-b9",		/* Truncated variable-length integer. */
+	"99999999999",	/* Overflow. */
+	"a-rc4g",	/* Surrogate. */
+	NULL
+};
+
+/* DNS wire format test cases. */
+static const struct {
+	const char *input;
+	/* Expected name, NULL if the input is invalid. */
+	const char *wire;
+	size_t wirelen;
+} wirestr[] = {
+	{"", "", 1},
+	{".", "", 1},
+	{"example", "\7example", 9},
+	{"example.", "\7example", 9},
+	{"münchen.example", "\16xn--mnchen-3ya\7example", 24},
+	{"www.도메인.example", "\3www\16xn--hq1bm8jm9l\7example", 28},
+	{"a..b", NULL, 0},
+	{".a", NULL, 0},
+	{"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+	    "\77aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+	    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", 65},
+	{"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+	    NULL, 0},
+	{NULL, NULL, 0}
+};
+
+/* Invalid input for punydec_wire(). */
+static const struct {
+	const char *wire;
+	size_t wirelen;
+} badwire[] = {
+	{"\13xn--a.b-xyz", 13},	/* The '.' would look like a separator. */
+	{"\13xn--a\0b-xyz", 13},	/* The result would stop at the NUL. */
+	{"\3a.b", 5},
+	{NULL, 0}
+};
+
+/* IDNA2008 test cases and the reason they fail for. */
+static const struct {
+	const char *input;
+	int reason;
+} idnastr[] = {
+	{"bücher.example", PUNYIDNA_OK},
+	{"Example.bücher", PUNYIDNA_OK},	/* ASCII labels aren't checked. */
+	{"", PUNYIDNA_OK},
+	{".", PUNYIDNA_OK},
+	{"ü..example", PUNYIDNA_SYNTAX},
+	{"Bücher", PUNYIDNA_DISALLOWED},	/* Not case folded. */
+	{"ü_", PUNYIDNA_DISALLOWED},
+	{"ü\xcd\xb8", PUNYIDNA_DISALLOWED},	/* U+0378 is unassigned. */
+	{"-bücher", PUNYIDNA_HYPHEN},
+	{"bücher-", PUNYIDNA_HYPHEN},
+	{"bü--cher", PUNYIDNA_HYPHEN},
+	{"bü-c-her", PUNYIDNA_OK},
+	{"\xcc\x81" "bücher", PUNYIDNA_COMBINING},
+	{"col\xc2\xb7lecció", PUNYIDNA_OK},	/* U+00B7 between 'l's. */
+	{"co\xc2\xb7lecció", PUNYIDNA_CONTEXTO},
+	{"col\xc2\xb7" "ecció", PUNYIDNA_CONTEXTO},
+	{"άλφα\xcd\xb5β", PUNYIDNA_OK},	/* U+0375 before Greek. */
+	{"άλφα\xcd\xb5" "b", PUNYIDNA_CONTEXTO},
+	{"άλφα\xcd\xb5", PUNYIDNA_CONTEXTO},
+	{"א\xd7\xb3", PUNYIDNA_OK},		/* U+05F3 after Hebrew. */
+	{"ü\xd7\xb3", PUNYIDNA_CONTEXTO},
+	{"ア・イ", PUNYIDNA_OK},		/* U+30FB with Katakana. */
+	{"ü・", PUNYIDNA_CONTEXTO},
+	{"ب\xd9\xa0\xd9\xa1", PUNYIDNA_OK},	/* ARABIC-INDIC DIGITs. */
+	{"\xd9\xa0\xdb\xb1", PUNYIDNA_CONTEXTO},
+	{"क्\xe2\x80\x8dष", PUNYIDNA_OK},	/* ZWJ after a virama. */
+	{"ü\xe2\x80\x8d", PUNYIDNA_CONTEXTJ},
+	{"ب\xe2\x80\x8cی", PUNYIDNA_OK},	/* ZWNJ between joining letters. */
+	{"ب\xd9\x8b\xe2\x80\x8c\xd9\x8bی", PUNYIDNA_OK},	/* T around it. */
+	{"ا\xe2\x80\x8cی", PUNYIDNA_CONTEXTJ},	/* Alef doesn't join left. */
+	{"ب\xe2\x80\x8cü", PUNYIDNA_CONTEXTJ},
+	{"שלום.example", PUNYIDNA_OK},
+	{"שלום1.example", PUNYIDNA_OK},
+	{"שלום.1example", PUNYIDNA_BIDI},	/* Starts with EN. */
+	{"1example.שלום", PUNYIDNA_BIDI},
+	{"üש", PUNYIDNA_BIDI},		/* R in a left-to-right label. */
+	{"1ü.example", PUNYIDNA_OK},		/* Not right-to-left. */
+	{"ש1٠", PUNYIDNA_BIDI},		/* EN and AN. */
+	{NULL, 0}
+};
+
 int
 main(void)
 {
@@ -40,6 +155,12 @@ main(void)
 
 	setlocale(LC_CTYPE, ".UTF-8");
 
+	/* Meson runs us once per kernel, skip those the CPU doesn't have. */
+	if ((in = getenv("PUNYCODE_ISA")) != NULL && strcmp(in, punyisa())) {
+		printf("%s kernels unsupported, running %s\n", in, punyisa());
+		exit(77);
+	}
+
 	for (i = 0; (in = teststr[i].input) != NULL; i++)
 		punytest(teststr[i].output, in);
 
@@ -58,11 +179,164 @@ main(void)
 		mbstowlower(foldedin);
 
 		punytest(teststr_ux[i].output, foldedin);
+		punydectest(foldedin, teststr_ux[i].output);
+		utftest(teststr_ux[i].output, foldedin);
+		cmptest(foldedin);
+		casetest(teststr_ux[i].output, foldedin, in);
+	}
+
+	for (i = 0; (in = teststr[i].input) != NULL; i++) {
+		punydectest(in, teststr[i].output);
+		utftest(teststr[i].output, in);
+		captest(in);
+		cmptest(in);
+		spantest(in);
+		casetest(teststr[i].output, in, NULL);
 	}
+	spantest(NULL);
+	longtest();
+	masktest();
+	captest(NULL);
+	batchtest();
+	pooltest();
+	statstest();
+	dbtest();
+	for (i = 0; (in = (char *)badpuny[i]) != NULL; i++)
+		punydectest(NULL, in);
+
+	for (i = 0; (in = (char *)wirestr[i].input) != NULL; i++)
+		wiretest(wirestr[i].wire, in, wirestr[i].wirelen);
+	for (i = 0; badwire[i].wire != NULL; i++) {
+		ret = punydec_wire(foldedin, (const unsigned char *)
+		    badwire[i].wire, badwire[i].wirelen, sizeof(foldedin));
+		if (ret != (size_t)-1)
+			errx(1, "punydec_wire accepted invalid name %d", i);
+	}
+
+	for (i = 0; (in = (char *)idnastr[i].input) != NULL; i++)
+		idnatest(in, idnastr[i].reason);
 
 	exit(0);
 }
 
+/* idnatest: punyenc_idna() must accept input like punyenc_host() or fail for
+ * reason
+ */
+static void
+idnatest(const char *input, int reason)
+{
+	char buf[PUNYBUFSZ], want[PUNYBUFSZ];
+	const char *p;
+	size_t len;
+	int got;
+
+	len = punyenc_idna(buf, input, sizeof(buf), &got);
+	if (got != reason) {
+		errx(1, "punyenc_idna(\"%s\"): reason %d, expected %d", input,
+		    got, reason);
+	}
+	if (reason != PUNYIDNA_OK) {
+		if (len != (size_t)-1)
+			errx(1, "punyenc_idna(\"%s\"): not an error", input);
+	} else if (len != punyenc_host(want, input, sizeof(want))
+	    || strcmp(buf, want) != 0) {
+		errx(1, "punyenc_idna(\"%s\"): \"%s\", expected \"%s\"", input,
+		    buf, want);
+	}
+
+	/* A hostname of a single non-ASCII label is checked the same alone. */
+	for (p = input; *p != '\0' && *p != '.'; p++)
+		;
+	if (*p == '\0' && *input != '\0'
+	    && punyenc_host(NULL, input, 0) != strlen(input)
+	    && (got = punyidna_label(input)) != reason) {
+		errx(1, "punyidna_label(\"%s\"): reason %d, expected %d", input,
+		    got, reason);
+	}
+}
+
+/* dbtest: build a database of the test strings, look them up both ways */
+static void
+dbtest(void)
+{
+	static const char *const miss[] = {"bücher.example", "ü", NULL};
+	static const char *const bad[] = {"a..ü", NULL};
+	const char **hosts;
+	const struct punydb *db;
+	char path[] = "/tmp/punydbXXXXXX";
+	char want[PUNYBUFSZ];
+	char buf[PUNYBUFSZ];
+	const char *ace;
+	const char *host;
+	size_t n, i;
+	size_t ret;
+	int fd;
+
+	/* Every test string that is a valid hostname, twice. */
+	for (n = 0; teststr[n].input != NULL; n++)
+		;
+	if ((hosts = calloc(2 * n, sizeof(*hosts))) == NULL)
+		err(1, "calloc");
+	for (n = i = 0; teststr[i].input != NULL; i++) {
+		if (strcmp(teststr[i].input, "ü") != 0
+		    && punyenc_host(NULL, teststr[i].input, 0) != (size_t)-1)
+			hosts[n++] = teststr[i].input;
+	}
+	memcpy(hosts + n, hosts, n * sizeof(*hosts));
+
+	if ((fd = mkstemp(path)) == -1)
+		err(1, "mkstemp");
+	if (punydb_build(fd, bad, 1) != -1 || errno != EINVAL)
+		errx(1, "punydb_build: accepted invalid hostname \"%s\"", *bad);
+	if (punydb_build(fd, hosts, 2 * n) == -1)
+		err(1, "punydb_build");
+	if ((db = punydb_open(path)) == NULL)
+		err(1, "punydb_open");
+
+	for (i = 0; i < n; i++) {
+		host = hosts[i];
+		(void)punyenc_host(want, host, sizeof(want));
+		ace = punydb_enc(db, host);
+		if (strcmp(want, host) == 0 ? ace != NULL
+		    : ace == NULL || strcmp(ace, want) != 0)
+			errx(1, "punydb_enc(db, \"%s\") = \"%s\", want \"%s\"",
+			    host, ace != NULL ? ace : "(null)", want);
+		if (ace != NULL && ((host = punydb_dec(db, ace)) == NULL
+		    || strcmp(host, hosts[i]) != 0))
+			errx(1, "punydb_dec(db, \"%s\") = \"%s\", want \"%s\"",
+			    ace, host != NULL ? host : "(null)", hosts[i]);
+		ret = punyenc_db(db, buf, hosts[i], 4);
+		if (ret != strlen(want) || strncmp(buf, want, 3) != 0
+		    || strlen(buf) != (ret < 3 ? ret : 3))
+			errx(1, "punyenc_db(db, buf, \"%s\", 4) truncated"
+			    " wrong", hosts[i]);
+	}
+	/* Misses fall back to punyenc_host(). */
+	for (i = 0; (host = miss[i]) != NULL; i++) {
+		(void)punyenc_host(want, host, sizeof(want));
+		ret = punyenc_db(db, buf, host, sizeof(buf));
+		if (punydb_enc(db, host) != NULL || punydb_dec(db, want) != NULL
+		    || ret != strlen(want) || strcmp(buf, want) != 0)
+			errx(1, "punyenc_db(db, buf, \"%s\", %zu) = \"%s\","
+			    " want \"%s\"", host, sizeof(buf), buf, want);
+	}
+	punydb_close(db);
+
+	/* A truncated database is rejected. */
+	if (ftruncate(fd, 64 + 8) == -1)
+		err(1, "ftruncate");
+	if (punydb_open(path) != NULL || errno != EINVAL)
+		errx(1, "punydb_open: accepted a truncated database");
+	if (ftruncate(fd, 0) == -1)
+		err(1, "ftruncate");
+	if (punydb_open(path) != NULL || errno != EINVAL)
+		errx(1, "punydb_open: accepted an empty file");
+
+	close(fd);
+	unlink(path);
+	free(hosts);
+}
+
 /* punytest: feed input to the punycode encoder, compare it to the output */
 static void
 punytest(const char *output, const char *input)
@@ -99,6 +373,751 @@ punytest(const char *output, const char *input)
 	}
 }
 
+/* punydectest: feed input to the punycode decoder, compare it to the output
+ *
+ * Set output to NULL if the input is invalid. Also checks that the decoder
+ * truncates its output properly.
+ */
+static void
+punydectest(const char *output, const char *input)
+{
+	char buf[PUNYBUFSZ];
+	char *errorstr;
+	size_t ret;
+	size_t sz;
+
+	ret = punydec(buf, input, sizeof(buf));
+	errorstr = NULL;
+	if (output == NULL) {
+		if (ret != (size_t)-1)
+			errorstr = "decoder accepted invalid input";
+	} else if (ret == (size_t)-1) {
+		errorstr = "decoder rejected valid input";
+	} else if (ret >= sizeof(buf)) {
+		errorstr = "decoded result is larger than buf";
+	} else if (strcasecmp(buf, output)) {
+		errorstr = "decoded result is wrong";
+	} else {
+		for (sz = 0; sz <= ret; sz++) {
+			if (punydec(buf, input, sz) != ret
+			    || (sz > 0 && strncasecmp(buf, output, sz-1))
+			    || (sz > 0 && buf[sz-1] != '\0')) {
+				errorstr = "truncated result is wrong";
+				break;
+			}
+		}
+	}
+
+	if (errorstr) {
+		printf("punydec(buf, \"%s\", %zu)\n", input, sizeof(buf));
+		fputs( "  Return value: ", stdout);
+		if (ret == (size_t)-1)
+			puts("(size_t)-1");
+		else
+			printf("%zu\n", ret);
+		printf(" Decode result: \"%s\"\n", buf);
+		printf("Correct result: \"%s\"\n", output ? output : "(error)");
+		printf("         Error: %s\n", errorstr);
+		exit(1);
+	}
+}
+
+/* wiretest: encode input to the DNS wire format and decode it back, and check
+ * that punyenc_host() agrees with punyenc_wire()
+ *
+ * Set wire to NULL if the input is invalid.
+ */
+static void
+wiretest(const char *wire, const char *input, size_t wirelen)
+{
+	unsigned char buf[PUNYBUFSZ];
+	char dec[PUNYBUFSZ];
+	char host[PUNYBUFSZ];
+	char *errorstr;
+	size_t ret;
+	size_t len;
+
+	ret = punyenc_wire(buf, input, sizeof(buf));
+	errorstr = NULL;
+	if (wire == NULL) {
+		if (ret != (size_t)-1)
+			errorstr = "encoder accepted invalid input";
+		else if (punyenc_host(host, input, sizeof(host)) != (size_t)-1)
+			errorstr = "punyenc_host accepted invalid input";
+		else if (punydec_host(dec, input, sizeof(dec)) != (size_t)-1)
+			errorstr = "punydec_host accepted invalid input";
+	} else if (ret != wirelen || memcmp(buf, wire, wirelen)) {
+		errorstr = "encoded result is wrong";
+	} else if ((len = punyenc_host(host, input, sizeof(host)))
+	    != strlen(host) || len >= sizeof(host)) {
+		errorstr = "punyenc_host returned the wrong length";
+	} else if (punyenc_wire(buf, host, sizeof(buf)) != wirelen
+	    || memcmp(buf, wire, wirelen)) {
+		/* The ACE hostname must have the same wire format. */
+		errorstr = "punyenc_host result is wrong";
+	} else if ((len = strlen(input)) > 0 && strlen(host) > 0
+	    && (input[len-1] == '.') != (host[strlen(host)-1] == '.')) {
+		errorstr = "punyenc_host lost or added the trailing dot";
+	} else if ((len = punydec_host(dec, host, sizeof(dec)))
+	    != strlen(input) || strcmp(dec, input) != 0) {
+		errorstr = "punydec_host(punyenc_host(s)) != s";
+	} else if (punydec_wire(dec, buf, ret, sizeof(dec)) == (size_t)-1) {
+		errorstr = "decoder rejected the encoded result";
+	} else {
+		/* The decoder doesn't output the trailing dot. */
+		len = strlen(input);
+		if (len > 1 && input[len-1] == '.')
+			len--;
+		if (len == 0)
+			input = ".", len = 1;
+		if (strlen(dec) != len || strncmp(dec, input, len))
+			errorstr = "decoded result is wrong";
+	}
+
+	if (errorstr) {
+		printf("punyenc_wire(buf, \"%s\", %zu)\n", input, sizeof(buf));
+		fputs( "  Return value: ", stdout);
+		if (ret == (size_t)-1)
+			puts("(size_t)-1");
+		else
+			printf("%zu\n", ret);
+		printf("         Error: %s\n", errorstr);
+		exit(1);
+	}
+}
+
+/* utftest: check the UTF-16 and UTF-32 variants of the encoder and decoder */
+static void
+utftest(const char *output, const char *input)
+{
+	uint_least32_t in32[PUNYBUFSZ];
+	uint_least16_t in16[PUNYBUFSZ];
+	uint_least32_t buf32[PUNYBUFSZ];
+	uint_least16_t buf16[PUNYBUFSZ];
+	uint_least32_t dec16[PUNYBUFSZ];
+	char buf[PUNYBUFSZ];
+	char *errorstr;
+	size_t len;
+	size_t i;
+
+	u8tou32(in32, input);
+	len = u32tou16(in16, in32);
+
+	errorstr = NULL;
+	if (punyenc_u32(buf, in32, sizeof(buf)) >= sizeof(buf)
+	    || strcasecmp(buf, output)) {
+		errorstr = "punyenc_u32: encoded result is wrong";
+	} else if (punyenc_u16(buf, in16, sizeof(buf)) >= sizeof(buf)
+	    || strcasecmp(buf, output)) {
+		errorstr = "punyenc_u16: encoded result is wrong";
+	} else if (punydec_u32(buf32, output, PUNYBUFSZ) >= PUNYBUFSZ
+	    || u32casecmp(buf32, in32)) {
+		errorstr = "punydec_u32: decoded result is wrong";
+	} else if (punydec_u16(buf16, output, PUNYBUFSZ) != len) {
+		errorstr = "punydec_u16: decoded result has the wrong length";
+	} else {
+		/* Widen the UTF-16 without decoding it to compare it. */
+		for (i = 0; i <= len; i++) {
+			dec16[i] = buf16[i];
+			buf32[i] = in16[i];
+		}
+		if (u32casecmp(dec16, buf32))
+			errorstr = "punydec_u16: decoded result is wrong";
+	}
+
+	if (errorstr) {
+		printf("utftest(\"%s\", \"%s\")\n", output, input);
+		printf("         Error: %s\n", errorstr);
+		exit(1);
+	}
+}
+
+/* longtest: round trip a string too long for the codec's UTF-32 fast path */
+static void
+longtest(void)
+{
+	static char in[PUNYBUFSZ * 8];
+	static char enc[PUNYBUFSZ * 8];
+	static char dec[PUNYBUFSZ * 8];
+	static uint_least32_t in32[PUNYBUFSZ * 8];
+	static uint_least16_t in16[PUNYBUFSZ * 8];
+	static uint_least16_t dec16[PUNYBUFSZ * 8];
+	size_t len;
+	size_t ret;
+	size_t sz;
+	int i;
+	char c;
+
+	in[0] = '\0';
+	for (i = 0; teststr[i].input != NULL; i++)
+		strcat(in, teststr[i].input);
+
+	len = strlen(in);
+	u8tou32(in32, in);
+	ret = punyenc(enc, in, sizeof(enc));
+	if (ret >= sizeof(enc))
+		errx(1, "longtest: punyenc failed");
+	if (punyenc_u32(dec, in32, sizeof(dec)) != ret || strcmp(dec, enc))
+		errx(1, "longtest: punyenc_u32 disagrees with punyenc");
+	u32tou16(in16, in32);
+	if (punyenc_u16(dec, in16, sizeof(dec)) != ret || strcmp(dec, enc))
+		errx(1, "longtest: punyenc_u16 disagrees with punyenc");
+
+	if (punydec(dec, enc, sizeof(dec)) != len || strcmp(dec, in))
+		errx(1, "longtest: punydec(punyenc(s)) != s");
+	/* The digits are converted in blocks, the last one is checked too. */
+	ret = strlen(enc);
+	c = enc[ret-1];
+	enc[ret-1] = '!';
+	if (punydec(NULL, enc, 0) != (size_t)-1)
+		errx(1, "longtest: punydec accepted an invalid last digit");
+	enc[ret-1] = c;
+	for (sz = 1; sz <= len; sz += 7) {
+		if (punydec(dec, enc, sz) != len || strncmp(dec, in, sz-1))
+			errx(1, "longtest: truncated punydec result is wrong");
+	}
+	ret = u32tou16(NULL, in32);
+	if (punydec_u16(dec16, enc, PUNYBUFSZ * 8) != ret
+	    || memcmp(dec16, in16, ret * sizeof(*dec16)))
+		errx(1, "longtest: punydec_u16(punyenc(s)) != s");
+}
+
+/* masktest: round trip labels on both sides of the short label encoder's limit
+ * Labels of up to 64 code points get their deltas from position masks, longer
+ * ones from rescanning the label.
+ */
+static void
+masktest(void)
+{
+	static const uint_least32_t pool[] = {
+		'a', 'z', '-', '0', 0xE9, 0xFC, 0x3B1, 0x5D0, 0x4E00, 0xD55C,
+		0x1F600, 0x10FFFF,
+	};
+	uint_least32_t in[80];
+	uint_least32_t dec[PUNYBUFSZ];
+	char enc[PUNYBUFSZ];
+	unsigned long x = 1;
+	size_t len;
+	size_t i, j;
+
+	for (i = 0; i < 3000; i++) {
+		len = i % 70 + 1;
+		for (j = 0; j < len; j++) {
+			x = (x * 1103515245 + 12345) & 0xFFFFFFFF;
+			in[j] = pool[(x >> 16) % (sizeof(pool) / sizeof(*pool))];
+		}
+		in[len] = 0;
+		if (punyenc_u32(enc, in, sizeof(enc)) >= sizeof(enc))
+			errx(1, "masktest: punyenc_u32 failed");
+		if (punydec_u32(dec, enc, PUNYBUFSZ) != len
+		    || u32casecmp(dec, in))
+			errx(1, "masktest: punydec_u32(punyenc_u32(s)) != s");
+	}
+
+	/* Deltas that overflow, in a short label and in a long one. */
+	in[0] = 0x80;
+	in[1] = 0xFFFFFFFF;
+	for (len = 2; len <= 70; len += 68) {
+		for (j = 2; j < len; j++)
+			in[j] = 'a';
+		in[len] = 0;
+		if (punyenc_u32(enc, in, sizeof(enc)) != (size_t)-1)
+			errx(1, "masktest: punyenc_u32 missed an overflow");
+	}
+}
+
+/* captest: check that punyenc_cap() stops exactly at its cap
+ *
+ * If input is NULL, check that it gives up on an input that is long and
+ * expensive to encode.
+ */
+static void
+captest(const char *input)
+{
+	static char hostile[1 << 20];
+	char buf[PUNYBUFSZ];
+	char enc[PUNYBUFSZ];
+	char *p;
+	size_t ret;
+	size_t len;
+	unsigned long c;
+
+	if (input == NULL) {
+		/* Every codepoint is distinct. */
+		for (c = 0x4E00, p = hostile; p + 4 < hostile + sizeof(hostile);
+		    c++) {
+			*p++ = 0xE0 | (c >> 12);
+			*p++ = 0x80 | ((c >> 6) & 0x3F);
+			*p++ = 0x80 | (c & 0x3F);
+		}
+		*p = '\0';
+		if (punyenc_cap(buf, hostile, sizeof(buf), 63) != (size_t)-2)
+			errx(1, "captest: punyenc_cap didn't give up");
+		return;
+	}
+
+	len = punyenc(enc, input, sizeof(enc));
+	ret = punyenc_cap(buf, input, sizeof(buf), len);
+	if (ret != len || strcmp(buf, enc))
+		errx(1, "captest: punyenc_cap(\"%s\", %zu) failed", input, len);
+	if (len > 0 && punyenc_cap(buf, input, sizeof(buf), len-1)
+	    != (size_t)-2) {
+		errx(1, "captest: punyenc_cap(\"%s\", %zu) didn't give up",
+		    input, len-1);
+	}
+}
+
+/* batchtest: encode and decode the test strings as a column */
+static void
+batchtest(void)
+{
+	static char data[PUNYBUFSZ * 16];
+	static char enc[PUNYBUFSZ * 16];
+	static char dec[PUNYBUFSZ * 16];
+	static char lanes[PUNYBUFSZ * 16];
+	uint32_t offsets[64];
+	uint32_t encoff[64];
+	uint32_t decoff[64];
+	uint32_t laneoff[64];
+	unsigned char status[64];
+	unsigned char lanestatus[64];
+	char buf[PUNYBUFSZ];
+	size_t len;
+	size_t ret;
+	size_t sz;
+	size_t n;
+	size_t i;
+
+	offsets[0] = 0;
+	for (n = 0; teststr[n].input != NULL; n++) {
+		len = strlen(teststr[n].input);
+		memcpy(data + offsets[n], teststr[n].input, len);
+		offsets[n+1] = offsets[n] + len;
+	}
+	ret = punyenc_batch(data, offsets, n, NULL, 0, encoff, NULL);
+	if (ret != encoff[n]
+	    || punyenc_batch(data, offsets, n, enc, sizeof(enc), encoff, status)
+	    != ret)
+		errx(1, "batchtest: punyenc_batch returned the wrong length");
+	for (i = 0; i < n; i++) {
+		len = punyenc(buf, teststr[i].input, sizeof(buf));
+		if (status[i] != PUNYBATCH_OK || encoff[i+1] - encoff[i] != len
+		    || memcmp(enc + encoff[i], buf, len)) {
+			errx(1, "batchtest: punyenc_batch row %zu is wrong",
+			    i);
+		}
+	}
+
+	/* The lane engine must agree, even when dst is too small. */
+	for (sz = 0; sz <= ret; sz += sz < 64 ? 1 : 61) {
+		memset(lanes, 0, sizeof(lanes));
+		if (punyenc_batch_lanes(data, offsets, n, lanes, sz, laneoff,
+		    lanestatus) != ret || memcmp(laneoff, encoff,
+		    (n+1) * sizeof(*encoff)) || memcmp(lanestatus, status, n)
+		    || memcmp(lanes, enc, sz)
+		    || (sz < ret && lanes[sz] != '\0'))
+			errx(1, "batchtest: punyenc_batch_lanes is wrong at"
+			    " dstsize %zu", sz);
+	}
+
+	/* The encoded column is the input for the decoder, plus a bad row. */
+	enc[encoff[n]] = '!';
+	encoff[n+1] = encoff[n] + 1;
+	ret = punydec_batch(enc, encoff, n+1, dec, sizeof(dec), decoff, status);
+	if (ret != offsets[n] || status[n] != PUNYBATCH_ERROR)
+		errx(1, "batchtest: punydec_batch returned the wrong result");
+	for (i = 0; i < n; i++) {
+		if (status[i] != PUNYBATCH_OK
+		    || decoff[i+1] - decoff[i] != offsets[i+1] - offsets[i]
+		    || memcmp(dec + decoff[i], data + offsets[i],
+		    offsets[i+1] - offsets[i])) {
+			errx(1, "batchtest: punydec_batch row %zu is wrong",
+			    i);
+		}
+	}
+}
+
+/* pooltest: check that the thread pool's output matches the serial output */
+static void
+pooltest(void)
+{
+	enum {ROWS = 20000};
+	static const int nthreads[] = {1, 2, 3, 8};
+	struct punypool *pool;
+	char *data, *ser, *par;
+	uint32_t *offsets, *seroff, *paroff;
+	unsigned char *serst, *parst;
+	size_t len;
+	size_t ret;
+	size_t i;
+	size_t n;
+	int t;
+	int dec;
+
+	offsets = malloc((ROWS + 1) * sizeof(*offsets));
+	seroff = malloc((ROWS + 1) * sizeof(*seroff));
+	paroff = malloc((ROWS + 1) * sizeof(*paroff));
+	serst = malloc(ROWS);
+	parst = malloc(ROWS);
+	data = malloc(ROWS * PUNYBUFSZ);
+	ser = malloc(ROWS * PUNYBUFSZ);
+	par = malloc(ROWS * PUNYBUFSZ);
+	if (offsets == NULL || seroff == NULL || paroff == NULL
+	    || serst == NULL || parst == NULL || data == NULL || ser == NULL
+	    || par == NULL)
+		err(1, "malloc");
+
+	/* Rows of varied length, some of which aren't valid punycode. */
+	for (n = 0; teststr[n].input != NULL; n++)
+		;
+	offsets[0] = 0;
+	for (i = 0; i < ROWS; i++) {
+		len = i % 7 != 0 ? strlen(teststr[i % n].input) : 0;
+		memcpy(data + offsets[i], teststr[i % n].input, len);
+		offsets[i+1] = offsets[i] + len;
+	}
+
+	for (dec = 0; dec <= 1; dec++) {
+		ret = (dec ? punydec_batch : punyenc_batch)(data, offsets, ROWS,
+		    ser, ROWS * PUNYBUFSZ, seroff, serst);
+		for (t = 0; t < (int)(sizeof(nthreads)/sizeof(*nthreads)); t++) {
+			if ((pool = punypool_new(nthreads[t])) == NULL)
+				err(1, "punypool_new");
+			/* Use the pool twice to check that it can be reused. */
+			for (i = 0; i < 2; i++) {
+				if ((dec ? punydec_batch_pool
+				    : punyenc_batch_pool)(pool, data, offsets,
+				    ROWS, par, ROWS * PUNYBUFSZ, paroff, parst)
+				    != ret || memcmp(ser, par, ret)
+				    || memcmp(seroff, paroff,
+				    (ROWS + 1) * sizeof(*seroff))
+				    || memcmp(serst, parst, ROWS)) {
+					errx(1, "pooltest: %s with %d threads"
+					    " differs from the serial output",
+					    dec ? "punydec_batch_pool"
+					    : "punyenc_batch_pool",
+					    nthreads[t]);
+				}
+			}
+			punypool_free(pool);
+		}
+	}
+
+	free(offsets);
+	free(seroff);
+	free(paroff);
+	free(serst);
+	free(parst);
+	free(data);
+	free(ser);
+	free(par);
+}
+
+/* Output of spancat(). */
+struct spans {
+	const char *src;
+	size_t nbasic;
+	char buf[PUNYBUFSZ * 4];
+	size_t len;
+	int calls;
+	int stopat;
+};
+
+/* spantest: check that the spans of punyenc_spans() add up to punyenc()'s output
+ * If input is NULL, uses a label that's long enough to hand out several spans
+ * from the encoder's buffer.
+ */
+static void
+spantest(const char *input)
+{
+	char longin[PUNYBUFSZ * 2];
+	char want[PUNYBUFSZ * 4];
+	struct spans sp;
+	size_t ret;
+	int i;
+
+	if (input == NULL) {
+		/* 96 distinct CJK code points between ASCII. */
+		for (ret = 0, i = 0; i < 96; i++) {
+			if (i % 16 == 0)
+				longin[ret++] = 'a' + i / 16;
+			ret += snprintf(longin + ret, sizeof(longin) - ret,
+			    "%lc", (wint_t)(0x4e00 + i * 7));
+		}
+		input = longin;
+	}
+
+	memset(&sp, 0, sizeof(sp));
+	sp.src = input;
+	for (i = 0; input[i] != '\0'; i++)
+		sp.nbasic += !(input[i] & 0x80);
+	ret = punyenc_spans(input, spancat, &sp);
+	if (punyenc(want, input, sizeof(want)) != ret || ret != sp.len
+	    || memcmp(want, sp.buf, ret))
+		errx(1, "punyenc_spans: wrong result for \"%s\"", input);
+
+	/* Stop at the last span. */
+	if ((i = sp.calls) == 0)
+		return;
+	sp.len = sp.calls = 0;
+	sp.stopat = i;
+	if (punyenc_spans(input, spancat, &sp) != (size_t)-1 || sp.calls != i)
+		errx(1, "punyenc_spans: didn't stop for \"%s\"", input);
+}
+
+/* casetest: encode and decode input with the case flags of its U+XXXX form
+ * If ux is NULL, the flags are all 0 and output is compared in lowercase.
+ */
+static void
+casetest(const char *output, const char *input, const char *ux)
+{
+	char buf[PUNYBUFSZ];
+	char lowout[PUNYBUFSZ];
+	char want[PUNYBUFSZ];
+	unsigned char flags[PUNYBUFSZ] = {0};
+	unsigned char got[PUNYBUFSZ];
+	unsigned char *small;
+	size_t n;
+	size_t ret;
+	size_t sz;
+
+	/* An uppercase 'U' asks for the code point to be shown in uppercase. */
+	for (n = 0; ux != NULL && *ux != '\0'; ux++) {
+		if ((*ux == 'u' || *ux == 'U') && ux[1] == '+')
+			flags[n++] = *ux == 'U';
+	}
+	for (sz = 0; (lowout[sz] = tolower((unsigned char)output[sz])); sz++)
+		;
+	if (n == 0)
+		output = lowout;
+
+	ret = punyenc_case(buf, input, n > 0 ? flags : NULL, sizeof(buf));
+	if (ret != strlen(output) || strcmp(buf, output))
+		errx(1, "punyenc_case: got \"%s\", want \"%s\"", buf, output);
+
+	for (sz = 0; (want[sz] = tolower((unsigned char)input[sz])); sz++)
+		;
+	ret = punydec_case(buf, output, got, sizeof(buf));
+	if (ret != strlen(want) || strcmp(buf, want) ||
+	    (n > 0 && memcmp(got, flags, n)))
+		errx(1, "punydec_case: wrong result for \"%s\"", output);
+
+	/* The flags array only needs room for dstsize-1 elements. */
+	for (sz = 1; sz <= ret + 1; sz++) {
+		if ((small = malloc(sz - 1 + (sz == 1))) == NULL)
+			err(1, "malloc");
+		if (punydec_case(buf, output, small, sz) != ret
+		    || strncmp(buf, want, sz - 1) || buf[sz-1] != '\0')
+			errx(1, "punydec_case: wrong truncated result for"
+			    " \"%s\"", output);
+		free(small);
+	}
+}
+
+/* spancat: the callback of spantest(), appends the span to the output */
+static int
+spancat(void *arg, const char *span, size_t len)
+{
+	struct spans *sp = arg;
+
+	/* Basic code points must be handed out without being copied. */
+	if (sp->len < sp->nbasic && (span < sp->src || span + len > sp->src
+	    + strlen(sp->src))) {
+		errx(1, "punyenc_spans: basic code points of \"%s\" were"
+		    " copied", sp->src);
+	}
+	if (sp->len + len > sizeof(sp->buf))
+		errx(1, "punyenc_spans: output too long");
+	memcpy(sp->buf + sp->len, span, len);
+	sp->len += len;
+	return ++sp->calls == sp->stopat;
+}
+
+/* cmptest: compare and hash input and its ACE form, and altered ACE forms */
+static void
+cmptest(const char *input)
+{
+	char ace[PUNYBUFSZ];
+	char alt[PUNYBUFSZ + 1];
+	size_t len;
+	const char *p;
+	static const struct {
+		const char *what;
+		int sign;
+	} alts[] = {
+		{"the same label in upper case", 0},
+		{"a label with a greater last byte", -1},
+		{"a shorter label", 1},
+		{"a longer label", -1},
+	};
+	int i;
+	int r;
+
+	for (p = input; *p != '\0' && !(*p & 0x80); p++)
+		;
+	if (*p == '\0') {
+		len = snprintf(ace, sizeof(ace), "%s", input);
+	} else {
+		memcpy(ace, "xn--", 4);
+		len = 4 + punyenc(ace + 4, input, sizeof(ace) - 4);
+	}
+	if (len >= sizeof(ace) || len == 0)
+		return;
+	if (punycmp(input, ace) != 0)
+		errx(1, "punycmp: \"%s\" doesn't match \"%s\"", input, ace);
+
+	for (i = 0; i < (int)(sizeof(alts) / sizeof(*alts)); i++) {
+		memcpy(alt, ace, len + 1);
+		switch (i) {
+		case 0:
+			for (p = alt; *p != '\0'; p++)
+				alt[p - alt] = toupper((unsigned char)*p);
+			break;
+		case 1:
+			alt[len-1] = alt[len-1] == 'z' ? '~' : alt[len-1] + 1;
+			break;
+		case 2:
+			alt[len-1] = '\0';
+			break;
+		case 3:
+			alt[len] = 'a';
+			alt[len+1] = '\0';
+			break;
+		}
+		r = punycmp(input, alt);
+		if ((r > 0) - (r < 0) != alts[i].sign) {
+			errx(1, "punycmp: wrong result comparing \"%s\" with"
+			    " %s, \"%s\"", input, alts[i].what, alt);
+		}
+		/* The hash must agree with punycmp(). */
+		if ((punyhash(input, i) == punyhash_ace(alt, i))
+		    != (alts[i].sign == 0)) {
+			errx(1, "punyhash: wrong result hashing \"%s\" and %s,"
+			    " \"%s\"", input, alts[i].what, alt);
+		}
+	}
+}
+
+/* statstest: check the encoder statistics, if the library keeps them */
+static void
+statstest(void)
+{
+	struct punystats st;
+	char buf[PUNYBUFSZ];
+	static const char *const labels[] = {
+		"abc",		/* 3 codepoints, 0 distinct. */
+		"bücher",	/* 6 codepoints, 1 distinct. */
+		"ñandú",	/* 5 codepoints, 2 distinct. */
+		NULL
+	};
+	static const uint32_t offsets[] = {0, 3, 5};
+	uint32_t dstoffsets[3];
+	uint_least64_t inbytes = 0, outbytes = 0;
+	int i;
+
+	punystats_reset();
+	if (punystats_get(&st) == -1)
+		return;
+	if (st.labels != 0)
+		errx(1, "statstest: punystats_reset didn't reset the counters");
+
+	for (i = 0; labels[i] != NULL; i++) {
+		inbytes += strlen(labels[i]);
+		outbytes += punyenc(buf, labels[i], sizeof(buf));
+	}
+	/* Truncated output still counts the whole punycode. */
+	outbytes += punyenc(buf, "bücher", 2);
+	inbytes += strlen("bücher");
+
+	if (punystats_get(&st) == -1)
+		errx(1, "statstest: punystats_get failed");
+	if (st.labels != 4 || st.ascii != 1 || st.overflows != 0
+	    || st.toolong != 0)
+		errx(1, "statstest: wrong label counts");
+	if (st.inbytes != inbytes || st.outbytes != outbytes)
+		errx(1, "statstest: wrong byte counts");
+	/* 3 is in bucket 2, 5 and 6 in bucket 3. */
+	if (st.inlen[2] != 1 || st.inlen[3] != 3)
+		errx(1, "statstest: wrong length histogram");
+	if (st.distinct[0] != 1 || st.distinct[1] != 2 || st.distinct[2] != 1)
+		errx(1, "statstest: wrong distinct codepoint histogram");
+
+	/* The fast paths for ASCII labels count them too. */
+	punystats_reset();
+	(void)punyenc_host(buf, "www.bücher.example", sizeof(buf));
+	(void)punyenc_batch("abcü", offsets, 2, buf, sizeof(buf), dstoffsets,
+	    NULL);
+	(void)punyenc_batch_lanes("abcü", offsets, 2, buf, sizeof(buf),
+	    dstoffsets, NULL);
+	if (punystats_get(&st) == -1)
+		errx(1, "statstest: punystats_get failed");
+	if (st.labels != 7 || st.ascii != 4)
+		errx(1, "statstest: ASCII labels weren't counted");
+	if (st.inbytes != 17 + 2 * strlen("abcü"))
+		errx(1, "statstest: ASCII bytes weren't counted");
+}
+
+/* u8tou32: convert valid UTF-8 to a 0 terminated array of codepoints.
+ *
+ * Returns the amount of codepoints.
+ */
+static size_t
+u8tou32(uint_least32_t *dst, const char *_src)
+{
+	const unsigned char *src = (const unsigned char *)_src;
+	size_t i;
+	int len;
+
+	for (i = 0; *src != '\0'; i++) {
+		len = *src < 0x80 ? 1 : *src < 0xE0 ? 2 : *src < 0xF0 ? 3 : 4;
+		dst[i] = *src++ & (len == 1 ? 0x7F : 0x7F >> len);
+		while (--len > 0)
+			dst[i] = dst[i] << 6 | (*src++ & 0x3F);
+	}
+	dst[i] = 0;
+	return i;
+}
+
+/* u32tou16: convert a 0 terminated array of codepoints to UTF-16.
+ *
+ * Set dst to NULL to only get the return value, which is the amount of code
+ * units.
+ */
+static size_t
+u32tou16(uint_least16_t *dst, const uint_least32_t *src)
+{
+	size_t i;
+
+	for (i = 0; *src != 0; src++) {
+		if (*src < 0x10000) {
+			if (dst != NULL)
+				dst[i] = *src;
+			i++;
+		} else {
+			if (dst != NULL) {
+				dst[i] = 0xD800 | ((*src - 0x10000) >> 10);
+				dst[i+1] = 0xDC00 | (*src & 0x3FF);
+			}
+			i += 2;
+		}
+	}
+	if (dst != NULL)
+		dst[i] = 0;
+	return i;
+}
+
+/* u32casecmp: compare 0 terminated codepoint arrays, ignoring ASCII case */
+static int
+u32casecmp(const uint_least32_t *a, const uint_least32_t *b)
+{
+	for (; *a != 0 || *b != 0; a++, b++) {
+		if ((*a < 0x80 ? tolower(*a) : *a)
+		    != (*b < 0x80 ? tolower(*b) : *b))
+			return 1;
+	}
+	return 0;
+}
+
 /* mbstowlower: convert multibyte string to lowercase in Standard C. */
 static void
 mbstowlower(char str[static 1])
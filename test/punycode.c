@@ -16,8 +16,10 @@
 
 #include <err.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <limits.h>
 #include <locale.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -28,9 +30,46 @@
 
 #include "punytest.h"
 
-static int pipechild(int *, int *, const char *);
+static int pipechild(int *, int *, const char *, const char *, const char *);
+static void waitchild(pid_t);
+static void fieldtest(const char *, const char *);
+static void dbtest(const char *);
+static void framedtest(const char *);
+static void ckpttest(const char *);
+static void reporttest(const char *);
+static pid_t filechild(const char *, const char *, const char *, const char *,
+    const char *);
 static void punytestutil(FILE *, FILE *, const char *, const char *);
 
+/* Tests of the field, zone file and log modes. */
+static const struct {
+	const char *opt[2];
+	const char *input;
+	const char *output;
+} fieldstr[] = {
+	{{"-f2", NULL}, "a\tbücher.Example.\tc", "a\txn--bcher-kva.example.\tc"},
+	{{"-f1", NULL}, "münchen\t1", "xn--mnchen-3ya\t1"},
+	{{"-f3", NULL}, "a\tb\tñandú", "a\tb\txn--and-6ma2c"},
+	{{"-f3", NULL}, "few\tfields", "few\tfields"},
+	{{"-f2", NULL}, "ASCII\tIS.Untouched", "ASCII\tIS.Untouched"},
+	{{"-f2", "-d,"}, "x,www.도메인.example,y", "x,www.xn--hq1bm8jm9l.example,y"},
+	{{"-f2", NULL}, "bad\tü..x\tline", "bad\tü..x\tline"},
+	{{"-z", NULL}, "$ORIGIN münchen.de.", "$ORIGIN xn--mnchen-3ya.de."},
+	{{"-z", NULL}, "www.bücher 3600 IN A 192.0.2.1",
+	    "www.xn--bcher-kva 3600 IN A 192.0.2.1"},
+	{{"-z", NULL}, "\tIN MX 10 bücher.", "\tIN MX 10 bücher."},
+	{{"-z", NULL}, "; bücher", "; bücher"},
+	{{"-l", NULL}, "GET http://bücher.example/a?b 200",
+	    "GET http://xn--bcher-kva.example/a?b 200"},
+	{{"-l", NULL}, "ascii http://Example.com/ü", "ascii http://Example.com/ü"},
+	{{"-l", NULL}, "from <jo@Müller.de>, to ñ@ñandú.com.",
+	    "from <jo@xn--mller-kva.de>, to ñ@xn--and-6ma2c.com."},
+	{{"-l", NULL}, "https://u:p@도메인.example:8080 “@bücher”",
+	    "https://u:p@xn--hq1bm8jm9l.example:8080 “@xn--bcher-kva”"},
+	{{"-l", NULL}, "no hosts in this line", "no hosts in this line"},
+	{{NULL, NULL}, NULL, NULL},
+};
+
 /* This is a test for the command line utility version of the encoder. */
 int
 main(int argc, char *argv[])
@@ -38,7 +77,6 @@ main(int argc, char *argv[])
 	int cfd_in, cfd_out; /* child fd stdin, stdout */
 	FILE *cf_in, *cf_out; /* child FILE stdin, stdout */
 	int i;
-	int status;
 	pid_t pid;
 	char buf[PUNYBUFSZ];
 	size_t ret;
@@ -54,7 +92,7 @@ main(int argc, char *argv[])
 	 * stdin and stdout to FILE structures that are under this test's
 	 * programmatic control.
 	 */
-	if ((pid = pipechild(&cfd_out, &cfd_in, argv[1])) == -1)
+	if ((pid = pipechild(&cfd_out, &cfd_in, argv[1], NULL, NULL)) == -1)
 		err(1, "pipechild");
 	if ((cf_in = fdopen(cfd_in, "w")) == NULL)
 		err(1, "fdopen");
@@ -78,9 +116,30 @@ main(int argc, char *argv[])
 		punytestutil(cf_out, cf_in, teststr_ux[i].output, buf);
 	}
 
+	/* A report of the statistics mustn't disturb the output. */
+	if (kill(pid, SIGUSR1) == -1)
+		err(1, "kill");
+	punytestutil(cf_out, cf_in, teststr[1].output, teststr[1].input);
+
 	fclose(cf_in);
 	fclose(cf_out);
 
+	waitchild(pid);
+
+	fieldtest(argv[1], NULL);
+	dbtest(argv[1]);
+	framedtest(argv[1]);
+	ckpttest(argv[1]);
+	reporttest(argv[1]);
+	return 0;
+}
+
+/* waitchild: wait for the child and exit if it failed */
+static void
+waitchild(pid_t pid)
+{
+	int status;
+
 	while (waitpid(pid, &status, 0) == -1) {
 		if (errno != EINTR)
 			err(1, "waitpid");
@@ -96,16 +155,345 @@ main(int argc, char *argv[])
 			errx(1, "child returned code %d", status);
 
 	}
-	return 0;
+}
+
+/* fieldtest: test the field, zone file and log modes of the utility in path
+ * If dbopt isn't NULL, it's passed as the second option, and the tests that
+ * already have one are skipped.
+ */
+static void
+fieldtest(const char *path, const char *dbopt)
+{
+	int cfd_in, cfd_out;
+	FILE *cf_in, *cf_out;
+	pid_t pid;
+	int i;
+
+	for (i = 0; fieldstr[i].input != NULL; i++) {
+		if (dbopt != NULL && fieldstr[i].opt[1] != NULL)
+			continue;
+		pid = pipechild(&cfd_out, &cfd_in, path, fieldstr[i].opt[0],
+		    dbopt != NULL ? dbopt : fieldstr[i].opt[1]);
+		if (pid == -1)
+			err(1, "pipechild");
+		if ((cf_in = fdopen(cfd_in, "w")) == NULL)
+			err(1, "fdopen");
+		if ((cf_out = fdopen(cfd_out, "r")) == NULL)
+			err(1, "fdopen");
+		if (setvbuf(cf_in, NULL, _IOLBF, 0))
+			err(1, "setvbuf");
+		punytestutil(cf_out, cf_in, fieldstr[i].output,
+		    fieldstr[i].input);
+		fclose(cf_in);
+		fclose(cf_out);
+		/* Invalid hostnames are passed through, but make it fail. */
+		if (strstr(fieldstr[i].input, "..") == NULL)
+			waitchild(pid);
+		else
+			waitpid(pid, NULL, 0);
+	}
+}
+
+/* dbtest: compile a database with -c, and run fieldtest() with it */
+static void
+dbtest(const char *path)
+{
+	static const char *const hosts[] = {
+		"Bücher.Example.", "münchen", "ñandú.com", "ñandú",
+		"münchen.de.", "www.bücher", "Müller.de", "도메인.example",
+		"ascii.example", "münchen",
+	};
+	char db[] = "/tmp/punydbXXXXXX";
+	char opt[sizeof(db) + 2];
+	int cfd_in, cfd_out;
+	FILE *cf_in;
+	pid_t pid;
+	size_t i;
+	int fd;
+
+	if ((fd = mkstemp(db)) == -1)
+		err(1, "mkstemp");
+	close(fd);
+
+	(void)snprintf(opt, sizeof(opt), "-c%s", db);
+	if ((pid = pipechild(&cfd_out, &cfd_in, path, opt, NULL)) == -1)
+		err(1, "pipechild");
+	if ((cf_in = fdopen(cfd_in, "w")) == NULL)
+		err(1, "fdopen");
+	for (i = 0; i < sizeof(hosts)/sizeof(*hosts); i++) {
+		if (fprintf(cf_in, "%s\n", hosts[i]) < 0)
+			err(1, "fprintf");
+	}
+	fclose(cf_in);
+	close(cfd_out);
+	waitchild(pid);
+
+	(void)snprintf(opt, sizeof(opt), "-m%s", db);
+	fieldtest(path, opt);
+	unlink(db);
+}
+
+/* framedtest: send the test strings in batches to the co-process mode */
+static void
+framedtest(const char *path)
+{
+	int cfd_in, cfd_out;
+	FILE *cf_in, *cf_out;
+	char *resp = NULL;
+	size_t respsz = 0;
+	ssize_t len;
+	char *line;
+	char *next;
+	pid_t pid;
+	int batch;
+	int i, j;
+
+	if ((pid = pipechild(&cfd_out, &cfd_in, path, "-F", NULL)) == -1)
+		err(1, "pipechild");
+	if ((cf_in = fdopen(cfd_in, "w")) == NULL)
+		err(1, "fdopen");
+	if ((cf_out = fdopen(cfd_out, "r")) == NULL)
+		err(1, "fdopen");
+
+	/* Batches of 0 to 4 lines, the first one is empty. */
+	for (i = batch = 0; teststr[i].input != NULL; i += batch++ % 5) {
+		for (j = i; j < i + batch % 5 && teststr[j].input != NULL; j++)
+			fprintf(cf_in, "%s\n", teststr[j].input);
+		if (putc('\0', cf_in) == EOF || fflush(cf_in) == EOF)
+			err(1, "fflush");
+
+		if ((len = getdelim(&resp, &respsz, '\0', cf_out)) == -1
+		    || resp[len-1] != '\0')
+			errx(1, "framedtest: batch %d wasn't answered", batch);
+		for (line = resp, j = i; *line != '\0'; line = next, j++) {
+			if ((next = strchr(line, '\n')) == NULL)
+				errx(1, "framedtest: unterminated line");
+			*next++ = '\0';
+			if (j == i + batch % 5 || strcasecmp(line,
+			    teststr[j].output) != 0)
+				errx(1, "framedtest: batch %d: \"%s\" is wrong",
+				    batch, line);
+		}
+		if (j != i + batch % 5 && teststr[j].input != NULL)
+			errx(1, "framedtest: batch %d is short", batch);
+	}
+	fclose(cf_in);
+	fclose(cf_out);
+	waitchild(pid);
+
+	/* A last line without a newline gets one, in field mode too. */
+	if ((pid = pipechild(&cfd_out, &cfd_in, path, "-F", "-f2")) == -1)
+		err(1, "pipechild");
+	if ((cf_in = fdopen(cfd_in, "w")) == NULL)
+		err(1, "fdopen");
+	if ((cf_out = fdopen(cfd_out, "r")) == NULL)
+		err(1, "fdopen");
+	if (fputs("x\tü.de", cf_in) == EOF || putc('\0', cf_in) == EOF
+	    || fflush(cf_in) == EOF)
+		err(1, "fflush");
+	if ((len = getdelim(&resp, &respsz, '\0', cf_out)) == -1
+	    || strcmp(resp, "x\txn--tda.de\n") != 0)
+		errx(1, "framedtest: the field answer isn't newline terminated");
+	fclose(cf_in);
+	fclose(cf_out);
+	waitchild(pid);
+	free(resp);
+}
+
+/* ckpttest: convert a file in two runs with a checkpoint
+ * The second run finds the lines the first one didn't see, after output the
+ * first one wrote past its checkpoint, and must pick up where it left off.
+ */
+static void
+ckpttest(const char *path)
+{
+	char dir[] = "/tmp/punyckptXXXXXX";
+	char in[sizeof(dir) + sizeof("/in")];
+	char out[sizeof(dir) + sizeof("/out")];
+	char ckpt[sizeof(dir) + sizeof("/ckpt")];
+	char opt[sizeof(ckpt) + 2];
+	char buf[PUNYBUFSZ];
+	FILE *fp;
+	int half;
+	int i;
+
+	if (mkdtemp(dir) == NULL)
+		err(1, "mkdtemp");
+	(void)snprintf(in, sizeof(in), "%s/in", dir);
+	(void)snprintf(out, sizeof(out), "%s/out", dir);
+	(void)snprintf(ckpt, sizeof(ckpt), "%s/ckpt", dir);
+	(void)snprintf(opt, sizeof(opt), "-k%s", ckpt);
+
+	for (half = 0; teststr[half].input != NULL; half++)
+		;
+	half /= 2;
+	if ((fp = fopen(in, "w")) == NULL)
+		err(1, "%s", in);
+	for (i = 0; i < half; i++)
+		fprintf(fp, "%s\n", teststr[i].input);
+	fclose(fp);
+	waitchild(filechild(path, in, out, opt, NULL));
+
+	if ((fp = fopen(in, "a")) == NULL)
+		err(1, "%s", in);
+	for (i = half; teststr[i].input != NULL; i++)
+		fprintf(fp, "%s\n", teststr[i].input);
+	fclose(fp);
+	if ((fp = fopen(out, "a")) == NULL)
+		err(1, "%s", out);
+	fputs("half a li", fp);
+	fclose(fp);
+	waitchild(filechild(path, in, out, opt, NULL));
+
+	if ((fp = fopen(out, "r")) == NULL)
+		err(1, "%s", out);
+	for (i = 0; teststr[i].input != NULL; i++) {
+		if (fgets(buf, sizeof(buf), fp) == NULL)
+			errx(1, "ckpttest: line %d is missing", i);
+		buf[strcspn(buf, "\n")] = '\0';
+		if (strcasecmp(buf, teststr[i].output) != 0)
+			errx(1, "ckpttest: line %d is \"%s\"", i, buf);
+	}
+	if (fgets(buf, sizeof(buf), fp) != NULL)
+		errx(1, "ckpttest: extra output \"%s\"", buf);
+	fclose(fp);
+
+	/* The checkpoint is only good for the same options. */
+	if (waitpid(filechild(path, in, out, opt, "-z"), &i, 0) == -1)
+		err(1, "waitpid");
+	if (!WIFEXITED(i) || WEXITSTATUS(i) == 0)
+		errx(1, "ckpttest: a run with other options resumed");
+
+	unlink(in);
+	unlink(out);
+	unlink(ckpt);
+	rmdir(dir);
+}
+
+/* reporttest: check the statistics reports of the utility in path
+ * Runs it with -s and stderr in a file, asks for a report with SIGUSR1 after the
+ * first line, and checks the counts of that report and of the one at exit.
+ */
+static void
+reporttest(const char *path)
+{
+	char errpath[] = "/tmp/punyreportXXXXXX";
+	char buf[PUNYBUFSZ];
+	int cfd_in, cfd_out;
+	FILE *cf_in, *cf_out;
+	FILE *fp;
+	pid_t pid;
+	int fd, saved;
+	int i;
+	int nreports, nrate, nlatency;
+	unsigned long long lines, bytes, encodings, errors;
+	unsigned long long sent[3], timed;
+	char *p;
+
+	/* The child inherits stderr. */
+	if ((fd = mkstemp(errpath)) == -1)
+		err(1, "mkstemp");
+	if ((saved = dup(2)) == -1 || dup2(fd, 2) == -1)
+		err(1, "dup");
+	pid = pipechild(&cfd_out, &cfd_in, path, "-s", NULL);
+	if (dup2(saved, 2) == -1)
+		err(1, "dup2");
+	close(saved);
+	close(fd);
+	if (pid == -1)
+		err(1, "pipechild");
+	if ((cf_in = fdopen(cfd_in, "w")) == NULL
+	    || (cf_out = fdopen(cfd_out, "r")) == NULL)
+		err(1, "fdopen");
+	if (setvbuf(cf_in, NULL, _IOLBF, 0) || setvbuf(cf_out, NULL, _IOLBF, 0))
+		err(1, "setvbuf");
+
+	/*
+	 * The report asked for after the 1st line comes before the 2nd line is
+	 * read, or after it's answered if the utility was already waiting for
+	 * it. The one at exit comes after the 3rd line.
+	 */
+	for (i = 0; i < 3; i++) {
+		punytestutil(cf_out, cf_in, teststr[i].output,
+		    teststr[i].input);
+		sent[i] = (i > 0 ? sent[i-1] : 0) + strlen(teststr[i].input)
+		    + 1;
+		if (i == 0 && kill(pid, SIGUSR1) == -1)
+			err(1, "kill");
+	}
+	fclose(cf_in);
+	fclose(cf_out);
+	waitchild(pid);
+
+	if ((fp = fopen(errpath, "r")) == NULL)
+		err(1, "%s", errpath);
+	nreports = nrate = nlatency = 0;
+	timed = 0;
+	while (fgets(buf, sizeof(buf), fp) != NULL) {
+		if (sscanf(buf, "pipechild: %llu lines, %llu bytes, %llu"
+		    " encodings, %llu errors", &lines, &bytes, &encodings,
+		    &errors) == 4) {
+			if (nreports == 2)
+				errx(1, "reporttest: more than 2 reports");
+			if ((nreports++ == 0 ? lines < 1 || lines > 2
+			    : lines != 3) || encodings != lines
+			    || bytes != sent[lines-1] || errors != 0) {
+				errx(1, "reporttest: report %d is wrong: %s",
+				    nreports, buf);
+			}
+		} else if (strstr(buf, " MB/s on average") != NULL) {
+			nrate++;
+		} else if (strncmp(buf, "pipechild: latency of 1 in ", 27)
+		    == 0) {
+			nlatency++;
+		} else if (strstr(buf, "u8_tolower") == NULL) {
+			/* A histogram row, the last column is the encoder. */
+			if ((p = strrchr(buf, ' ')) == NULL)
+				errx(1, "reporttest: bad line: %s", buf);
+			timed += strtoull(p, NULL, 10);
+		}
+	}
+	fclose(fp);
+	unlink(errpath);
+	if (nreports != 2 || nrate != 2 || nlatency != 2)
+		errx(1, "reporttest: %d reports, expected 2", nreports);
+	/* 1 in 16 encodings is timed, the first one of both reports. */
+	if (timed != 2)
+		errx(1, "reporttest: %llu timed encodings, expected 2", timed);
+}
+
+/* filechild: fork&exec the program in path with stdin read from the file in
+ * and stdout appended to the file out. opt1 and opt2 are options, or NULL.
+ */
+static pid_t
+filechild(const char *path, const char *in, const char *out, const char *opt1,
+    const char *opt2)
+{
+	pid_t pid;
+	int fd;
+
+	switch (pid = fork()) {
+	case -1:
+		err(1, "fork");
+	case 0:
+		if ((fd = open(in, O_RDONLY)) == -1 || dup2(fd, 0) == -1
+		    || (fd = open(out, O_WRONLY | O_APPEND | O_CREAT, 0666))
+		    == -1 || dup2(fd, 1) == -1)
+			_exit(1);
+		execl(path, "filechild", opt1, opt2, NULL);
+		_exit(1);
+	}
+	return pid;
 }
 
 /* pipechild: fork&exec the program in path, puts its stdout pipe in output and
- * stdin pipe in input.
+ * stdin pipe in input. opt1 and opt2 are extra options, or NULL.
  *
  * Returns -1 on error.
  */
 static pid_t
-pipechild(int *output, int *input, const char *path)
+pipechild(int *output, int *input, const char *path, const char *opt1,
+    const char *opt2)
 {
 	int child_stdin[2] = {-1, -1};
 	int child_stdout[2] = {-1, -1};
@@ -123,7 +511,8 @@ pipechild(int *output, int *input, const char *path)
 		close(child_stdin[1]);
 		if (dup2(child_stdout[1], 1) == -1
 		    || dup2(child_stdin[0], 0) == -1
-		    || execl(path, "pipechild", "-Dunbuffered", NULL) == -1)
+		    || execl(path, "pipechild", "-Dunbuffered", opt1, opt2,
+		    NULL) == -1)
 			_exit(1);
 		break;
 	default:
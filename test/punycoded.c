@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2023 Guilherme Janczak <guilherme.janczak@yandex.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include <punycode.h>
+
+#include "punytest.h"
+
+static pid_t startd(const char *, const char *);
+static int dial(const char *);
+static void clienttest(struct punyd *);
+static void pipelinetest(const char *);
+static void badtest(const char *);
+static void filetest(const char *, const char *);
+static void check(const char *, int, const char *, size_t, const char *,
+    size_t);
+
+/* Hostnames to convert both ways, valid or not. */
+static const char *hosts[] = {
+	"", ".", "example", "münchen.example.", "www.도메인.example",
+	"xn--mnchen-3ya.example", "xn--hq1bm8jm9l", "XN--BCHER-KVA.Example",
+	"a..b", ".a", "xn--", "xn--a-ecp.ru", "bücher.xn--99", "ü\n",
+	NULL
+};
+
+/* This is a test for punycoded and its client. */
+int
+main(int argc, char *argv[])
+{
+	char dir[] = "/tmp/punycoded.XXXXXX";
+	char sock[sizeof(dir) + sizeof("/sock")];
+	struct punyd *d, *d2;
+	char buf[PUNYBUFSZ];
+	pid_t pid;
+	int status;
+
+	if (argc != 2) {
+		errx(1, "this test is missing its argument:"
+		    " the path to the daemon");
+	}
+	if (mkdtemp(dir) == NULL)
+		err(1, "mkdtemp");
+	snprintf(sock, sizeof(sock), "%s/sock", dir);
+
+	/* Without the daemon, the client does the work itself. */
+	if ((d = punyd_open(sock)) == NULL)
+		err(1, "punyd_open");
+	clienttest(d);
+	clienttest(NULL);
+
+	filetest(argv[1], sock);
+	pid = startd(argv[1], sock);
+	clienttest(d);
+	clienttest(d);	/* From the cache this time. */
+	if ((d2 = punyd_open(sock)) == NULL)
+		err(1, "punyd_open");
+	/* Interleave the requests of two clients. */
+	if (punyd_enc(d2, buf, "bücher", sizeof(buf)) != 13)
+		errx(1, "punyd_enc: wrong length");
+	clienttest(d);
+	if (punyd_dec(d2, buf, "xn--bcher-kva", sizeof(buf)) != 7)
+		errx(1, "punyd_dec: wrong length");
+	pipelinetest(sock);
+	badtest(sock);
+
+	/* After the daemon is gone, the client does the work itself again. */
+	if (kill(pid, SIGTERM) == -1)
+		err(1, "kill");
+	while (waitpid(pid, &status, 0) == -1) {
+		if (errno != EINTR)
+			err(1, "waitpid");
+	}
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		errx(1, "punycoded didn't exit cleanly");
+	if (access(sock, F_OK) == 0)
+		errx(1, "punycoded didn't remove %s", sock);
+	clienttest(d);
+	clienttest(d2);
+
+	punyd_close(d);
+	punyd_close(d2);
+	rmdir(dir);
+	return 0;
+}
+
+/* startd: start the daemon in path on the socket sock, and wait for it */
+static pid_t
+startd(const char *path, const char *sock)
+{
+	pid_t pid;
+	int fd;
+	int i;
+
+	switch (pid = fork()) {
+	case -1:
+		err(1, "fork");
+	case 0:
+		/* A small cache so entries get replaced. */
+		execl(path, "punycoded", "-d", "-j4", "-c64", "-s", sock, NULL);
+		err(1, "execl");
+	}
+	for (i = 0; (fd = dial(sock)) == -1; i++) {
+		if (i == 500)
+			errx(1, "punycoded didn't start listening");
+		usleep(10000);
+	}
+	close(fd);
+	return pid;
+}
+
+/* dial: connect to the socket at path, returns -1 on failure */
+static int
+dial(const char *path)
+{
+	struct sockaddr_un addr;
+	int fd;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path);
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) == -1)
+		err(1, "socket");
+	if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/* clienttest: the client must agree with punyenc_host() and punydec_host() */
+static void
+clienttest(struct punyd *d)
+{
+	char buf[PUNYBUFSZ], want[PUNYBUFSZ];
+	size_t len, wantlen;
+	int i;
+
+	for (i = 0; hosts[i] != NULL; i++) {
+		len = punyd_enc(d, buf, hosts[i], sizeof(buf));
+		wantlen = punyenc_host(want, hosts[i], sizeof(want));
+		check(hosts[i], 'e', buf, len, want, wantlen);
+		len = punyd_dec(d, buf, hosts[i], sizeof(buf));
+		wantlen = punydec_host(want, hosts[i], sizeof(want));
+		check(hosts[i], 'd', buf, len, want, wantlen);
+	}
+	for (i = 0; teststr[i].input != NULL; i++) {
+		len = punyd_enc(d, buf, teststr[i].input, sizeof(buf));
+		wantlen = punyenc_host(want, teststr[i].input, sizeof(want));
+		check(teststr[i].input, 'e', buf, len, want, wantlen);
+	}
+}
+
+/* pipelinetest: send many requests before reading any answer
+ * They're all different, so most must be converted, and the daemon's threads
+ * get to convert them.
+ */
+static void
+pipelinetest(const char *sock)
+{
+	enum {nreq = 1000};
+	char name[64];
+	char line[PUNYBUFSZ], want[PUNYBUFSZ];
+	char *req;
+	size_t reqlen, wantlen;
+	FILE *fp;
+	int fd;
+	int i;
+
+	if ((req = malloc(nreq * sizeof(name))) == NULL)
+		err(1, "malloc");
+	reqlen = 0;
+	for (i = 0; i < nreq; i++) {
+		reqlen += sprintf(req + reqlen, "%cbücher%d.example\n",
+		    i % 3 ? 'e' : 'd', i);
+	}
+	if ((fd = dial(sock)) == -1)
+		err(1, "%s", sock);
+	if (write(fd, req, reqlen) != (ssize_t)reqlen)
+		err(1, "write");
+	if ((fp = fdopen(fd, "r")) == NULL)
+		err(1, "fdopen");
+
+	for (i = 0; i < nreq; i++) {
+		snprintf(name, sizeof(name), "bücher%d.example", i);
+		if (i % 3)
+			wantlen = punyenc_host(want, name, sizeof(want));
+		else
+			wantlen = punydec_host(want, name, sizeof(want));
+		if (fgets(line, sizeof(line), fp) == NULL)
+			errx(1, "pipelinetest: answer %d is missing", i);
+		line[strcspn(line, "\n")] = '\0';
+		if (wantlen == (size_t)-1 ? strcmp(line, "-") != 0
+		    : line[0] != '+' || strcmp(line + 1, want) != 0)
+			errx(1, "pipelinetest: answer %d is \"%s\"", i, line);
+	}
+	fclose(fp);
+	free(req);
+}
+
+/* badtest: the daemon hangs up on a client that breaks the protocol */
+static void
+badtest(const char *sock)
+{
+	static const char req[] = "eexample\nxexample\neexample\n";
+	char buf[PUNYBUFSZ];
+	ssize_t len;
+	size_t off = 0;
+	int fd;
+
+	if ((fd = dial(sock)) == -1)
+		err(1, "%s", sock);
+	if (write(fd, req, sizeof(req) - 1) != sizeof(req) - 1)
+		err(1, "write");
+	while ((len = read(fd, buf + off, sizeof(buf) - off)) > 0)
+		off += len;
+	if (len == -1)
+		err(1, "read");
+	if (off != sizeof("+example\n") - 1
+	    || memcmp(buf, "+example\n", off) != 0)
+		errx(1, "badtest: wrong answer before hanging up");
+	close(fd);
+}
+
+/* filetest: the daemon refuses to replace a file that isn't a socket */
+static void
+filetest(const char *path, const char *sock)
+{
+	FILE *fp;
+	pid_t pid;
+	int status;
+
+	if ((fp = fopen(sock, "w")) == NULL)
+		err(1, "%s", sock);
+	fclose(fp);
+	switch (pid = fork()) {
+	case -1:
+		err(1, "fork");
+	case 0:
+		execl(path, "punycoded", "-d", "-s", sock, NULL);
+		err(1, "execl");
+	}
+	while (waitpid(pid, &status, 0) == -1) {
+		if (errno != EINTR)
+			err(1, "waitpid");
+	}
+	if (!WIFEXITED(status) || WEXITSTATUS(status) == 0)
+		errx(1, "filetest: punycoded started on a regular file");
+	if (unlink(sock) == -1)
+		err(1, "filetest: punycoded removed %s", sock);
+}
+
+/* check: compare the client's answer with the library's */
+static void
+check(const char *input, int op, const char *got, size_t gotlen,
+    const char *want, size_t wantlen)
+{
+	if (gotlen != wantlen) {
+		errx(1, "punyd_%s(\"%s\"): returned %zu, expected %zu",
+		    op == 'e' ? "enc" : "dec", input, gotlen, wantlen);
+	}
+	if (wantlen != (size_t)-1 && strcmp(got, want) != 0) {
+		errx(1, "punyd_%s(\"%s\"): got \"%s\", expected \"%s\"",
+		    op == 'e' ? "enc" : "dec", input, got, want);
+	}
+}